@@ -20,7 +20,8 @@ namespace ui
 	Image::Image(const std::string& imagePath)
 		: Widget(0, 0, 0, 0) // Call base constructor with default values
 	{
-		if (!m_texture.loadFromFile(imagePath))
+		StartupAssetScope asset(imagePath, StartupAssetKind::Texture);
+		if (!asset.Complete(m_texture.loadFromFile(imagePath)))
 		{
 			throw std::runtime_error("Failed to load image: " + imagePath);
 		}
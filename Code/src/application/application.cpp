@@ -4,37 +4,176 @@
 #include "stockMarket.h" // StockMarket used directly in SetupStockMarket()
 #include "inventory.h"   // Inventory used directly in SetupInventory()
 #include "utilTools.h"   // Utility functions used in this translation unit
+#include "../framework/TextureCache.h"
+#include "../framework/ImageResampler.h"
 #include <sstream>
 #include <iomanip>
 #include <cmath>
 #include <algorithm>
 #include <random>
+#include <cstdlib>
+#include <ctime>
+#include <chrono>
+#include <thread>
+#include <iostream>
 
 // Static member definitions
 std::string Application::s_dataPath;
 std::string Application::s_assetsPath;
+std::string Application::s_bakedAssetsPath;
+std::set<std::string> Application::s_bakedTextures;
 float Application::s_totalGameTime = 0.0f;
 float Application::s_globalTimeMultiplier = 1.0f;
 float Application::s_previousTimeMultiplier = 1.0f;
+bool Application::s_useHardwareCursor = true;
+unsigned int Application::s_targetFrameRate = 60;
+unsigned int Application::s_idleFrameRate = 5;
+bool Application::s_verticalSync = false;
+float Application::s_traceCaptureSeconds = 60.0f;
 
 /// @brief Constructor - initializes all member variables to default values
 /// Initializes UI pointers, input mode settings, and gamepad cursor configuration
 Application::Application()
-	: m_applicationUI(nullptr)
-	, m_monitorMenuContainer(nullptr)
-	, m_monitor1Container(nullptr)
-	, m_gameTimeText(nullptr)
+	: m_inTradePause(false) // Initially not in trade pause
+	, m_traceOnStart(false)
+	, m_traceStopRequested(false)
+	, m_closeRequested(false)
+	, m_headless(false)
+	, m_playback(false)
+	, m_playbackFast(false)
+	, m_inputFrame(0)
+	, m_divergedFrame(UINT32_MAX)
+	, m_hardwareCursorLoaded(false)
 	, m_currentInputMode(InputMode::Mouse)
 	, m_gamepadCursorPosition(960.0f, 540.0f) // Center of 1920x1080 screen
 	, m_lastMousePosition(0, 0)
 	, m_gamepadCursorSpeed(500.0f) // pixels per second
 	, m_gamepadId(0)
-	, m_inTradePause(false) // Initially not in trade pause
+	, m_wasAButtonPressed(false)
+	, m_applicationUI(nullptr)
+	, m_monitorMenuContainer(nullptr)
+	, m_monitor1Container(nullptr)
+	, m_gameTimeText(nullptr)
 {
 }
+
+/// @brief Applies command line options
+/// @param argc Argument count from main
+/// @param argv Arguments from main
+/// Supported: --trace[=seconds] records a trace of the main loop from the first frame,
+/// --headless[=script.json] with --frames=N, --headless-report=file, --golden-dir=dir, --golden-every=N and
+/// --draw-baseline=file [--write-draw-baseline] renders offscreen for frame time and draw call regression tests (see HeadlessRunner),
+/// --record=file saves the session's input and --playback=file [--playback-fast] replays it (see InputRecording),
+/// --metrics-port=N [--metrics-address=ip] serves Prometheus metrics and --metrics-file=path [--metrics-interval=seconds]
+/// appends them to a rotated file (see MetricsExporter), --startup-report=file writes the startup timeline as JSON
+void Application::ParseCommandLine(int argc, char* argv[])
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string argument = argv[i];
+		if (argument == "--trace" || argument.compare(0, 8, "--trace=") == 0)
+		{
+			m_traceOnStart = true;
+			if (argument.size() > 8)
+			{
+				float seconds = static_cast<float>(std::atof(argument.c_str() + 8));
+				if (seconds > 0.0f)
+				{
+					s_traceCaptureSeconds = seconds;
+				}
+			}
+		}
+		else if (argument == "--headless" || argument.compare(0, 11, "--headless=") == 0)
+		{
+			m_headless = true;
+			m_headlessSettings.m_scriptPath = argument.size() > 11 ? argument.substr(11) : "";
+		}
+		else if (argument.compare(0, 9, "--frames=") == 0)
+		{
+			m_headlessSettings.m_frames = static_cast<uint32_t>(std::strtoul(argument.c_str() + 9, nullptr, 10));
+		}
+		else if (argument.compare(0, 18, "--headless-report=") == 0)
+		{
+			m_headlessSettings.m_reportPath = argument.substr(18);
+		}
+		else if (argument.compare(0, 13, "--golden-dir=") == 0)
+		{
+			m_headlessSettings.m_goldenDir = argument.substr(13);
+		}
+		else if (argument.compare(0, 15, "--golden-every=") == 0)
+		{
+			m_headlessSettings.m_goldenEvery = static_cast<uint32_t>(std::strtoul(argument.c_str() + 15, nullptr, 10));
+		}
+		else if (argument.compare(0, 16, "--draw-baseline=") == 0)
+		{
+			m_headlessSettings.m_drawBaselinePath = argument.substr(16);
+		}
+		else if (argument == "--write-draw-baseline")
+		{
+			m_headlessSettings.m_writeDrawBaseline = true;
+		}
+		else if (argument.compare(0, 9, "--record=") == 0)
+		{
+			m_recordPath = argument.substr(9);
+		}
+		else if (argument.compare(0, 11, "--playback=") == 0)
+		{
+			m_playbackPath = argument.substr(11);
+		}
+		else if (argument == "--playback-fast")
+		{
+			m_playbackFast = true;
+		}
+		else if (argument.compare(0, 15, "--metrics-port=") == 0)
+		{
+			m_metricsSettings.m_port = static_cast<unsigned short>(std::strtoul(argument.c_str() + 15, nullptr, 10));
+		}
+		else if (argument.compare(0, 18, "--metrics-address=") == 0)
+		{
+			m_metricsSettings.m_address = argument.substr(18);
+		}
+		else if (argument.compare(0, 15, "--metrics-file=") == 0)
+		{
+			m_metricsSettings.m_filePath = argument.substr(15);
+		}
+		else if (argument.compare(0, 19, "--metrics-interval=") == 0)
+		{
+			float seconds = static_cast<float>(std::atof(argument.c_str() + 19));
+			if (seconds > 0.0f)
+			{
+				m_metricsSettings.m_fileIntervalSeconds = seconds;
+			}
+		}
+		else if (argument.compare(0, 17, "--startup-report=") == 0)
+		{
+			m_startupReportPath = argument.substr(17);
+		}
+		else if (argument == "--assert-no-alloc")
+		{
+			// Assert on allocations inside MEMORY_NO_ALLOC_SCOPE hot paths (builds with MEMORY_TRACKING_ENABLED)
+			MemoryTracker::Get().SetAssertNoAlloc(true);
+			if (!MemoryTracker::IsEnabled())
+			{
+				DebugLog("--assert-no-alloc has no effect: this build does not track allocations", DebugType::Warning);
+			}
+		}
+		else if (argument == "--verbose")
+		{
+			SetDebugLogLevel(DebugType::Verbose);
+		}
+		else
+		{
+			DebugLog("Unknown command line option: " + argument, DebugType::Warning);
+		}
+	}
+}
 /// @brief Destructor - cleans up resources and releases memory
-/// Uses default destruction for all smart pointers and SFML objects
-Application::~Application() = default;
+/// Stops the texture cache worker before SFML objects are released
+Application::~Application()
+{
+	m_metricsExporter.reset();
+	ui::TextureCache::Get().Shutdown();
+}
 
 /// @brief Gets a shared random number generator instance
 /// @return Reference to a static Mersenne Twister random number generator
@@ -51,6 +190,45 @@ std::mt19937& Application::GetRandomGenerator()
 /// Called once at application startup to prepare all subsystems
 void Application::Initialize()
 {
+	// Phases and asset loads are timed until ReportStartupTimeline at the end
+	StartupTimeline::Get().Start();
+
+	// Headless runs, recordings and playback fix the random seed before the market draws its initial values
+	if (m_headless)
+	{
+		m_headlessRunner = std::make_unique<HeadlessRunner>(m_headlessSettings);
+		if (m_headlessRunner->LoadScript())
+		{
+			GetRandomGenerator().seed(m_headlessRunner->GetSeed());
+		}
+		else
+		{
+			m_headlessRunner.reset();
+		}
+	}
+	else if (!m_playbackPath.empty())
+	{
+		// Playback uses the recorded seed; a file that does not load ends Run with an error
+		m_playback = true;
+		m_inputRecording = std::make_unique<InputRecording>();
+		if (m_inputRecording->Load(m_playbackPath))
+		{
+			GetRandomGenerator().seed(m_inputRecording->GetSeed());
+		}
+		else
+		{
+			m_inputRecording.reset();
+		}
+	}
+	uint32_t recordingSeed = 0;
+	if (!m_headless && !m_playback && !m_recordPath.empty())
+	{
+		// A recording starts from a fresh seed that is stored with the input
+		recordingSeed = std::random_device()();
+		GetRandomGenerator().seed(recordingSeed);
+		m_inputRecording = std::make_unique<InputRecording>();
+	}
+
 	// Configure video settings (window size, framerate, etc.)
 	SetVideoSettings();
 
@@ -61,15 +239,20 @@ void Application::Initialize()
 	DebugLog("DEBUG mode: Using development folder structure");
 	SetDataPath("../../data/");
 	SetAssetsPath("../../assets/");
+	s_bakedAssetsPath = "../../assets_baked/";
 #else
 	DebugLog("RELEASE mode: Using portable paths relative to executable");
 	std::string exeDir = GetExecutableDirectory();
 	SetDataPath((exeDir + "data/").c_str());
 	SetAssetsPath((exeDir + "assets/").c_str());
+	s_bakedAssetsPath = exeDir + "assets_baked/";
 #endif
 	DebugLog("Data path: " + s_dataPath);
 	DebugLog("Assets path: " + s_assetsPath);
 
+	// Prefer pre-scaled textures produced by the asset baker when available
+	LoadBakedAssetIndex();
+
 	// Initialize core game systems
 	SetupStockMarket();
 	SetupCustomCursor();
@@ -91,10 +274,67 @@ void Application::Initialize()
 	}
 	SetupInventory();
 
-	// Initialize inventory buttons after setup
+	// Frame profiler overlay, hidden until toggled with F3
+	m_profilerHud = std::make_unique<ui::WidgetProfilerHud>(10, 10);
+	m_profilerHud->SetRenderContext(m_renderContext.get());
+	m_profilerHud->SetVisible(false);
+
+	// Show the initial inventory, money and volume reported during setup
 	if (m_applicationUI)
 	{
-		m_applicationUI->UpdateInventoryVerticalButtons();
+		STARTUP_PHASE("ApplyModelChanges");
+		m_applicationUI->ApplyModelChanges(m_modelChangeBus);
+	}
+
+	// Metrics are exported from a background thread once setup (and its load timings) is done
+	if (m_metricsSettings.m_port != 0 || !m_metricsSettings.m_filePath.empty())
+	{
+		m_metricsExporter = std::make_unique<MetricsExporter>(m_metricsSettings);
+		m_metricsExporter->Start();
+	}
+
+	// The state after setup tells whether a playback starts from the same data files as its recording
+	if (m_inputRecording)
+	{
+		uint64_t startChecksum = m_stockMarket ? m_stockMarket->ComputeStateChecksum() : 0;
+		if (!m_playback)
+		{
+			m_inputRecording->BeginRecording(recordingSeed, startChecksum, m_lastMousePosition);
+			DebugLog("Recording input to " + m_recordPath + " (seed " + std::to_string(recordingSeed) + ")");
+		}
+		else
+		{
+			m_lastMousePosition = m_inputRecording->GetStartMousePosition();
+			if (startChecksum != m_inputRecording->GetStartChecksum())
+			{
+				DebugLog("Playback - Initial state differs from the recording (other data files?); playback will diverge", DebugType::Warning);
+			}
+		}
+	}
+
+	ReportStartupTimeline();
+}
+
+/// @brief Ends the startup timeline and prints where Initialize spent its time
+/// Lists every phase with its wall, self, read and decode time, then the slowest asset files;
+/// textures still decoding on the texture cache thread at this point are not included
+void Application::ReportStartupTimeline()
+{
+	StartupTimeline& timeline = StartupTimeline::Get();
+	timeline.Finish();
+
+	std::ostringstream report;
+	timeline.WriteReport(report, s_startupReportAssets);
+	DebugLog(report.str());
+
+	if (!m_startupReportPath.empty())
+	{
+		std::ofstream file(m_startupReportPath);
+		timeline.WriteJson(file);
+		if (!file.good())
+		{
+			DebugLog("Startup - Could not write the report to " + m_startupReportPath, DebugType::Error);
+		}
 	}
 }
 
@@ -103,10 +343,28 @@ void Application::Initialize()
 /// Sets up the SFML window with title and performance parameters
 void Application::SetVideoSettings()
 {
+	STARTUP_PHASE("SetVideoSettings");
+	// Headless runs draw the same 1920x1080 frame into a texture; there is nothing to pace
+	if (m_headless)
+	{
+		m_renderTexture = std::make_unique<sf::RenderTexture>();
+		if (!m_renderTexture->create(1920, 1080))
+		{
+			DebugLog("Headless - Could not create the render texture (no OpenGL context)", DebugType::Error);
+		}
+		m_renderContext = std::make_unique<RenderContext>(*m_renderTexture);
+		return;
+	}
+
 	// Create 1920x1080 window with specified title
-	m_renderContext = std::make_unique<RenderContext>(sf::VideoMode(1920, 1080), "Hyper Trade");
-	// Limit framerate to 30 FPS for consistent performance
-	m_renderContext->setFramerateLimit(30);
+	m_renderWindow = std::make_unique<sf::RenderWindow>(sf::VideoMode(1920, 1080), "Hyper Trade");
+	m_renderContext = std::make_unique<RenderContext>(*m_renderWindow);
+	// Frame rate is limited by the pacer at the start of each frame (see Run)
+	ui::FramePacerSettings pacerSettings;
+	pacerSettings.m_targetFrameRate = s_targetFrameRate;
+	pacerSettings.m_idleFrameRate = s_idleFrameRate;
+	pacerSettings.m_verticalSync = s_verticalSync;
+	m_framePacer.Configure(*m_renderWindow, pacerSettings);
 }
 
 /// @brief Initializes the stock market system
@@ -114,6 +372,7 @@ void Application::SetVideoSettings()
 /// Loads JSON data and sets up market simulation parameters
 void Application::SetupStockMarket()
 {
+	STARTUP_PHASE("SetupStockMarket");
 	// Create stock market instance
 	m_stockMarket = std::make_unique<StockMarket>();
 	// Load market data and initialize trading system with application reference
@@ -125,6 +384,7 @@ void Application::SetupStockMarket()
 /// Sets up initial inventory state and item storage capabilities
 void Application::SetupInventory()
 {
+	STARTUP_PHASE("SetupInventory");
 	// Create player inventory instance
 	m_playerInventory = std::make_unique<Inventory>();
 	// Initialize inventory with default settings and application reference
@@ -136,10 +396,12 @@ void Application::SetupInventory()
 /// Supports both mouse and gamepad cursor control with automatic mode switching
 void Application::SetupCustomCursor()
 {
+	STARTUP_PHASE("SetupCustomCursor");
 	// Load custom cursor texture from assets
-	std::string cursorPath = s_assetsPath + "Cursor2.png";
+	std::string cursorPath = ResolveTexturePath("Cursor2.png");
 
-	if (!m_cursorTexture.loadFromFile(cursorPath))
+	StartupAssetScope cursorAsset(cursorPath, StartupAssetKind::Texture);
+	if (!cursorAsset.Complete(m_cursorTexture.loadFromFile(cursorPath)))
 	{
 		// Handle error - cursor texture not found
 		//DebugLog("Failed to load cursor texture from: " + cursorPath, DebugType::Error);
@@ -158,47 +420,86 @@ void Application::SetupCustomCursor()
 	// Set cursor origin to top-left corner for precise positioning
 	m_cursorSprite.setOrigin(0, 0);
 
+	// Hardware cursor for mouse mode: moves with the OS at input rate instead of the frame rate
+	if (s_useHardwareCursor && m_renderWindow)
+	{
+		m_hardwareCursorLoaded = LoadHardwareCursor(cursorPath);
+	}
+
 	// Initialize dual input mode system (mouse/gamepad)
-	if (m_renderContext)
+	if (m_renderWindow)
 	{
 		// Set gamepad cursor to screen center as starting position
-		sf::Vector2u windowSize = m_renderContext->getSize();
+		sf::Vector2u windowSize = m_renderWindow->getSize();
 		m_gamepadCursorPosition.x = static_cast<float>(windowSize.x) / 2.0f;
 		m_gamepadCursorPosition.y = static_cast<float>(windowSize.y) / 2.0f;
 
 		// Store initial mouse position for input mode detection
-		m_lastMousePosition = sf::Mouse::getPosition(*m_renderContext);
+		m_lastMousePosition = sf::Mouse::getPosition(*m_renderWindow);
+
+		// Show the hardware cursor or hide the system cursor for custom rendering
+		UpdateSystemCursor();
+	}
+}
+
+/// @brief Creates the OS cursor from the custom cursor image
+/// @param cursorPath Path of the cursor image (baked or original)
+/// @return true if the platform accepted the cursor
+/// The image is scaled to the same 25x25 size as the software sprite, with the hotspot at the top-left corner
+bool Application::LoadHardwareCursor(const std::string& cursorPath)
+{
+	sf::Image cursorImage;
+	StartupAssetScope cursorAsset(cursorPath, StartupAssetKind::Image);
+	if (!cursorAsset.Complete(cursorImage.loadFromFile(cursorPath)))
+	{
+		return false;
+	}
+
+	// The baked cursor already has the target size; the original one is scaled down here once
+	const unsigned int cursorSize = 25;
+	if (cursorImage.getSize() != sf::Vector2u(cursorSize, cursorSize))
+	{
+		cursorImage = ui::ResampleImage(cursorImage, cursorSize, cursorSize);
+	}
 
-		// Hide system cursor since we're using custom rendering
-		m_renderContext->setMouseCursorVisible(false);
+	if (!m_hardwareCursor.loadFromPixels(cursorImage.getPixelsPtr(), cursorImage.getSize(), sf::Vector2u(0, 0)))
+	{
+		DebugLog("Hardware cursor not supported, using software cursor", DebugType::Warning);
+		return false;
 	}
+	return true;
+}
+
+/// @brief Shows the hardware cursor in mouse mode, hides the system cursor when the sprite is drawn instead
+/// Called whenever the input mode changes
+void Application::UpdateSystemCursor()
+{
+	if (!m_renderWindow)
+		return;
+
+	bool showHardwareCursor = m_hardwareCursorLoaded && m_currentInputMode == InputMode::Mouse;
+	if (showHardwareCursor)
+	{
+		m_renderWindow->setMouseCursor(m_hardwareCursor);
+	}
+	m_renderWindow->setMouseCursorVisible(showHardwareCursor);
 }
 
 /// @brief Detects and switches between Mouse and Gamepad input modes automatically
-/// Monitors mouse movement and gamepad analog stick input to determine active input device
+/// Monitors gamepad analog stick input to determine active input device (mouse movement is detected in InputHandle)
 /// Provides seamless switching with cursor position continuity between modes
 void Application::UpdateInputMode()
 {
-	if (!m_renderContext)
+	if (!m_renderWindow)
 		return;
 
-	// Detect mouse movement and switch to Mouse mode if movement detected
-	sf::Vector2i currentMousePos = sf::Mouse::getPosition(*m_renderContext);
-	if (currentMousePos != m_lastMousePosition)
-	{
-		if (m_currentInputMode != InputMode::Mouse)
-		{
-			m_currentInputMode = InputMode::Mouse;
-			//DebugLog("Switched to Mouse input mode", DebugType::Message);
-		}
-		m_lastMousePosition = currentMousePos;
-	}
+	// Mouse movement is detected from the events collected in InputHandle (no extra cursor query)
 
 	// Detect gamepad analog stick movement and switch to Gamepad mode if input detected
-	if (sf::Joystick::isConnected(m_gamepadId))
+	if (m_gamepad.m_connected)
 	{
-		float axisX = sf::Joystick::getAxisPosition(m_gamepadId, sf::Joystick::X);
-		float axisY = sf::Joystick::getAxisPosition(m_gamepadId, sf::Joystick::Y);
+		float axisX = m_gamepad.m_axisX;
+		float axisY = m_gamepad.m_axisY;
 
 		// Apply deadzone threshold to prevent noise-triggered mode switches
 		float deadzone = 15.0f; // 15% deadzone to filter out analog stick drift
@@ -208,8 +509,9 @@ void Application::UpdateInputMode()
 			{
 				m_currentInputMode = InputMode::Gamepad;
 				// Seamless transition: set gamepad cursor to current mouse position
-				m_gamepadCursorPosition.x = static_cast<float>(currentMousePos.x);
-				m_gamepadCursorPosition.y = static_cast<float>(currentMousePos.y);
+				m_gamepadCursorPosition.x = static_cast<float>(m_lastMousePosition.x);
+				m_gamepadCursorPosition.y = static_cast<float>(m_lastMousePosition.y);
+				UpdateSystemCursor();
 				//DebugLog("Switched to Gamepad input mode", DebugType::Message);
 			}
 		}
@@ -222,12 +524,12 @@ void Application::UpdateInputMode()
 void Application::UpdateGamepadCursor(sf::Time delta)
 {
 	// Only update in Gamepad mode and if gamepad is actually connected
-	if (m_currentInputMode != InputMode::Gamepad || !sf::Joystick::isConnected(m_gamepadId))
+	if (m_currentInputMode != InputMode::Gamepad || !m_gamepad.m_connected)
 		return;
 
-	// Read left analog stick values (X and Y axes)
-	float axisX = sf::Joystick::getAxisPosition(m_gamepadId, sf::Joystick::X);
-	float axisY = sf::Joystick::getAxisPosition(m_gamepadId, sf::Joystick::Y);
+	// Left analog stick values (X and Y axes)
+	float axisX = m_gamepad.m_axisX;
+	float axisY = m_gamepad.m_axisY;
 
 	// Apply deadzone to prevent cursor drift from analog stick noise
 	float deadzone = 15.0f; // 15% deadzone threshold
@@ -244,45 +546,348 @@ void Application::UpdateGamepadCursor(sf::Time delta)
 	m_gamepadCursorPosition.y += moveY * speed;
 
 	// Clamp cursor position to stay within screen boundaries
-	if (m_renderContext)
+	if (m_renderWindow)
 	{
-		sf::Vector2u windowSize = m_renderContext->getSize();
+		sf::Vector2u windowSize = m_renderWindow->getSize();
 		m_gamepadCursorPosition.x = std::max(0.0f, std::min(static_cast<float>(windowSize.x), m_gamepadCursorPosition.x));
 		m_gamepadCursorPosition.y = std::max(0.0f, std::min(static_cast<float>(windowSize.y), m_gamepadCursorPosition.y));
 	}
 }
 
+/// @brief Reads the gamepad right analog stick as a scroll input
+/// @return Vertical stick deflection in range -1..1, 0 inside the deadzone or without gamepad
+float Application::GetGamepadScrollAxis() const
+{
+	if (!m_gamepad.m_connected || !m_gamepad.m_hasScrollAxis)
+		return 0.0f;
+
+	// Right stick vertical axis (reported as R for XInput pads)
+	float axis = m_gamepad.m_axisScroll;
+
+	// Apply deadzone so stick drift does not scroll
+	float deadzone = 15.0f; // 15% deadzone threshold
+	if (std::abs(axis) < deadzone)
+		return 0.0f;
+
+	return axis / 100.0f;
+}
+
 /// @brief Main application loop - handles timing, updates, input, and rendering
 /// Runs continuously until window is closed, managing frame timing and system updates
 /// Coordinates all subsystems including input detection, game logic, and display rendering
-void Application::Run()
+int Application::Run()
 {
+	if (m_headless)
+	{
+		return RunHeadless();
+	}
+	if (m_playback && !m_inputRecording)
+	{
+		return 1;
+	}
+
 	sf::Clock clock;
 	sf::Time timeSinceLastApplicationUpdate = sf::Time::Zero;
+	sf::Clock wallClock;
+	sf::Time recordedTime = sf::Time::Zero; // Sum of the recorded frame times played back so far
+
+	TRACE_THREAD_NAME("Main");
+	if (m_traceOnStart)
+	{
+		StartTraceCapture();
+	}
 
 	// Main game loop - continues until window close is requested
-	while (m_renderContext->isOpen())
+	while (!m_closeRequested)
 	{
-		// Calculate frame time delta for frame-rate independent updates
+		if (m_playback)
+		{
+			if (m_inputFrame >= m_inputRecording->GetFrameCount())
+				break;
+
+			// Playback runs at the recorded pace, or back to back with --playback-fast
+			recordedTime += m_inputRecording->GetFrameDelta(m_inputFrame);
+			sf::Time ahead = recordedTime - wallClock.getElapsedTime();
+			if (!m_playbackFast && ahead > sf::Time::Zero)
+			{
+				sf::sleep(ahead);
+			}
+		}
+		else
+		{
+			// Sleep before reading input rather than after display(), so input is as fresh as possible
+			m_framePacer.WaitForNextFrame(IsIdle());
+		}
+
+		// End a capture between frames so the last one recorded is complete
+		if (TraceRecorder::Get().IsRecording() && (m_traceStopRequested || TraceRecorder::Get().GetRecordedSeconds() >= s_traceCaptureSeconds))
+		{
+			StopTraceCapture();
+		}
+		TRACE_SCOPE("Frame");
+
+		// Calculate frame time delta for frame-rate independent updates; playback reuses the recorded one
 		sf::Time delta = clock.restart();
+		Metrics::Get().Add(MetricCounter::Frames);
+		Metrics::Get().Observe(MetricHistogram::FrameSeconds, delta.asSeconds());
+		if (m_playback)
+		{
+			delta = m_inputRecording->GetFrameDelta(m_inputFrame);
+			m_inputRecording->QueueFrameInput(m_inputFrame, m_inputQueue);
+		}
 		timeSinceLastApplicationUpdate += delta;
 
+		PROFILE_BEGIN_FRAME();
+
+		// Process user input (keyboard, mouse, gamepad) first so it shows in this frame
+		InputHandle();
+
 		// Update all game systems with accumulated time
 		ApplicationUpdate(timeSinceLastApplicationUpdate);
 		timeSinceLastApplicationUpdate = sf::Time::Zero;
 
-		// Process user input (keyboard, mouse, gamepad)
+		// Render all visual elements to screen (fast playback only simulates)
+		if (!m_playback || !m_playbackFast)
+		{
+			DisplayHandle();
+			m_framePacer.MarkPresented();
+		}
+
+		if (m_inputRecording)
+		{
+			if (!m_playback)
+			{
+				m_inputRecording->RecordFrame(delta, m_inputQueue.GetEvents(), m_gamepad, s_globalTimeMultiplier);
+			}
+			else if (!m_inputRecording->CheckTimeMultiplier(m_inputFrame, s_globalTimeMultiplier) && m_divergedFrame == UINT32_MAX)
+			{
+				m_divergedFrame = m_inputFrame;
+			}
+			++m_inputFrame;
+		}
+
+		ReportInputLatency();
+		PROFILE_END_FRAME();
+		MEMORY_END_FRAME();
+	}
+
+	// Window closed during a capture: keep what was recorded
+	StopTraceCapture();
+	m_renderWindow->close();
+	return FinishInputRecording(recordedTime, wallClock.getElapsedTime());
+}
+
+/// @brief Saves the recording, or reports how the playback compares with it
+/// @param recordedTime Recorded duration of the frames played back
+/// @param wallTime Real time the main loop ran
+/// @return Process exit code: non-zero if the recording was not written or the playback diverged
+int Application::FinishInputRecording(sf::Time recordedTime, sf::Time wallTime)
+{
+	if (!m_inputRecording)
+		return 0;
+
+	uint64_t endChecksum = m_stockMarket ? m_stockMarket->ComputeStateChecksum() : 0;
+	if (!m_playback)
+	{
+		m_inputRecording->EndRecording(endChecksum);
+		return m_inputRecording->Save(m_recordPath) ? 0 : 1;
+	}
+
+	uint32_t frameCount = m_inputRecording->GetFrameCount();
+	double wallSeconds = std::max(static_cast<double>(wallTime.asSeconds()), 0.001);
+	std::cout << std::fixed << std::setprecision(2)
+		<< "Playback: " << m_inputFrame << " of " << frameCount << " frames, " << recordedTime.asSeconds() << " s recorded in "
+		<< wallSeconds << " s (" << recordedTime.asSeconds() / wallSeconds << "x)" << std::endl;
+
+	bool matches = true;
+	if (m_inputFrame < frameCount)
+	{
+		std::cout << "  stopped before the end of the recording" << std::endl;
+		matches = false;
+	}
+	if (m_divergedFrame != UINT32_MAX)
+	{
+		std::cout << "  time multiplier diverged at frame " << m_divergedFrame << std::endl;
+		matches = false;
+	}
+	if (m_inputFrame == frameCount)
+	{
+		bool checksumMatches = endChecksum == m_inputRecording->GetEndChecksum();
+		std::cout << "  final state " << (checksumMatches ? "matches" : "differs from") << " the recording" << std::endl;
+		matches = matches && checksumMatches;
+	}
+	return matches ? 0 : 1;
+}
+
+/// @brief Main loop of a headless run: scripted input, fixed frame time, offscreen rendering
+/// @return Process exit code, non-zero if the script or the report failed or the draw counts exceeded the baseline
+/// Each frame is timed per phase (input, update, draw) with the draw statistics of the render
+/// context; frames requested by the script or --golden-every are written as PNG files
+int Application::RunHeadless()
+{
+	if (!m_headlessRunner || !m_renderTexture || m_renderTexture->getSize().x == 0)
+	{
+		return 1;
+	}
+
+	using Clock = std::chrono::steady_clock;
+	auto elapsedMs = [](Clock::time_point from, Clock::time_point to)
+	{
+		return std::chrono::duration<double, std::milli>(to - from).count();
+	};
+
+	HeadlessRunner& runner = *m_headlessRunner;
+	sf::Time frameTime = sf::seconds(runner.GetFrameSeconds());
+	TRACE_THREAD_NAME("Main");
+	if (m_traceOnStart)
+	{
+		StartTraceCapture();
+	}
+
+	for (uint32_t frame = 0; frame < runner.GetFrameCount() && !m_closeRequested; ++frame)
+	{
+		// Scripted F9 stops the capture between frames, as in Run
+		if (TraceRecorder::Get().IsRecording() && (m_traceStopRequested || TraceRecorder::Get().GetRecordedSeconds() >= s_traceCaptureSeconds))
+		{
+			StopTraceCapture();
+		}
+		TRACE_SCOPE("Frame");
+		PROFILE_BEGIN_FRAME();
+		Clock::time_point frameStart = Clock::now();
+
+		runner.QueueFrameInput(frame, m_inputQueue);
 		InputHandle();
-		// Render all visual elements to screen
+		Clock::time_point inputEnd = Clock::now();
+
+		for (uint32_t cycles = runner.GetFrameCycles(frame); cycles > 0; --cycles)
+		{
+			m_stockMarket->RunMarketCycle();
+		}
+		ApplicationUpdate(frameTime);
+		Clock::time_point updateEnd = Clock::now();
+
+		DisplayHandle();
+		Clock::time_point drawEnd = Clock::now();
+		PROFILE_END_FRAME();
+		MEMORY_END_FRAME();
+
+		HeadlessFrameSample sample;
+		sample.m_cpuMs = elapsedMs(frameStart, drawEnd);
+		Metrics::Get().Add(MetricCounter::Frames);
+		Metrics::Get().Observe(MetricHistogram::FrameSeconds, sample.m_cpuMs / 1000.0);
+		sample.m_inputMs = elapsedMs(frameStart, inputEnd);
+		sample.m_updateMs = elapsedMs(inputEnd, updateEnd);
+		sample.m_drawMs = elapsedMs(updateEnd, drawEnd);
+		const RenderStats& renderStats = m_renderContext->GetLastFrameStats();
+		sample.m_drawCalls = renderStats.m_drawCalls;
+		sample.m_vertices = renderStats.m_vertices;
+		sample.m_textureChanges = renderStats.m_textureChanges;
+		runner.AddSample(sample);
+
+		std::string goldenName;
+		if (runner.GetGoldenFrame(frame, goldenName))
+		{
+			SettleHeadlessFrame();
+			runner.SaveGoldenFrame(*m_renderTexture, goldenName);
+		}
+	}
+
+	StopTraceCapture();
+	runner.PrintSummary();
+	bool reportWritten = runner.WriteReport();
+	bool withinDrawBaseline = runner.CheckDrawBaseline();
+	return reportWritten && withinDrawBaseline ? 0 : 1;
+}
+
+/// @brief Redraws the current frame until the textures it requested are decoded
+/// Golden frames must not depend on how fast the loader thread was; the redraws are not timed
+void Application::SettleHeadlessFrame()
+{
+	ui::TextureCache& cache = ui::TextureCache::Get();
+	for (int attempt = 0; attempt < 500 && cache.GetQueuedCount() > 0; ++attempt)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		cache.Update();
 		DisplayHandle();
 	}
 }
 
+/// @brief Ends the main loop after the current frame
+void Application::RequestClose()
+{
+	m_closeRequested = true;
+}
+
+/// @brief Starts recording a trace of the main loop, market cycles and loader threads
+void Application::StartTraceCapture()
+{
+	if (TraceRecorder::Get().IsRecording())
+		return;
+
+	TraceRecorder::Get().Start();
+	DebugLog("Trace capture started (" + std::to_string(static_cast<int>(s_traceCaptureSeconds)) + " s, F9 stops early)");
+}
+
+/// @brief Stops a running trace capture and writes it as trace_<unix time>.json to the working directory
+/// The file opens in chrome://tracing or ui.perfetto.dev
+void Application::StopTraceCapture()
+{
+	m_traceStopRequested = false;
+	TraceRecorder& recorder = TraceRecorder::Get();
+	if (!recorder.IsRecording())
+		return;
+
+	float seconds = recorder.GetRecordedSeconds();
+	std::string path = "trace_" + std::to_string(static_cast<long long>(std::time(nullptr))) + ".json";
+	if (recorder.Stop(path))
+	{
+		DebugLog("Trace capture of " + std::to_string(seconds) + " s written to " + path);
+	}
+	else
+	{
+		DebugLog("Trace capture could not be written to " + path, DebugType::Error);
+	}
+
+	if (size_t dropped = recorder.GetDroppedEvents())
+	{
+		DebugLog("Trace capture dropped " + std::to_string(dropped) + " events (thread buffer full)", DebugType::Warning);
+	}
+}
+
+/// @brief Checks whether frames can be paced at the idle rate
+/// @return true while the game is paused and no input arrived for a second
+/// Nothing animates while paused; the short grace period keeps hover feedback smooth
+bool Application::IsIdle() const
+{
+	return s_globalTimeMultiplier <= 0.0f && m_lastInputClock.getElapsedTime() > sf::seconds(1.0f);
+}
+
+/// @brief Logs the input-to-present latency every 10 seconds
+/// Reports the average range (input read to present, previous input read to present) over the frames that had input
+void Application::ReportInputLatency()
+{
+	if (m_latencyReportClock.getElapsedTime() < sf::seconds(10.0f))
+		return;
+	m_latencyReportClock.restart();
+
+	const ui::InputLatencyStats& stats = m_framePacer.GetLatencyStats();
+	if (stats.m_samples > 0)
+	{
+		std::ostringstream report;
+		report << std::fixed << std::setprecision(1) << "Input latency " << stats.GetAverageMinMs() << "-" << stats.GetAverageMaxMs()
+			<< " ms (worst " << stats.m_peakMaxMs << " ms) over " << stats.m_samples << " frames";
+		DebugLog(report.str());
+	}
+	m_framePacer.ResetLatencyStats();
+}
+
 /// @brief Updates all application subsystems with frame timing
 /// @param delta Time elapsed since last update for frame-rate independent calculations
 /// Coordinates input mode detection, cursor movement, game time, and market simulation updates
 void Application::ApplicationUpdate(sf::Time delta)
 {
+	PROFILE_SCOPE("ApplicationUpdate");
+
 	//DebugLog("Application ApplicationUpdate called: " + std::to_string(delta.asSeconds()) + " seconds", DebugType::Message);
 
 	// Apply global time multiplier to delta for consistent time scaling across all systems
@@ -292,6 +897,9 @@ void Application::ApplicationUpdate(sf::Time delta)
 	UpdateInputMode();
 	UpdateGamepadCursor(delta); // Cursor movement not affected by time scaling
 
+	// Collect background texture decodes and keep lazily loaded images within budget
+	ui::TextureCache::Get().Update();
+
 	// Update global game time tracking for UI display
 	TotalGameTimeUpdate(scaledDelta);
 
@@ -308,8 +916,20 @@ void Application::ApplicationUpdate(sf::Time delta)
 	// Update rolling text animation and cycle progress bar (not affected by global time multiplier)
 	if (m_applicationUI)
 	{
+		// Refresh the widgets bound to values the market or inventory changed this frame
+		m_applicationUI->ApplyModelChanges(m_modelChangeBus);
+
 		m_applicationUI->UpdateApplicationUI(scaledDelta);
 		m_applicationUI->UpdateCycleProgressBar();
+
+		// Inventory list scrolling (wheel easing and right stick) runs on unscaled time
+		m_applicationUI->UpdateInventoryList(delta, GetGamepadScrollAxis());
+	}
+
+	// Profiler overlay refreshes its numbers a few times per second (real time)
+	if (m_profilerHud)
+	{
+		m_profilerHud->Update(delta);
 	}
 }
 
@@ -335,24 +955,42 @@ void Application::TotalGameTimeUpdate(sf::Time& delta)
 /// Supports both mouse and gamepad cursor rendering based on current input mode
 void Application::DisplayHandle()
 {
+	PROFILE_SCOPE("DisplayHandle");
+	MEMORY_TAG_SCOPE(MemoryTag::UI, "DisplayHandle");
+
 	// Clear previous frame with background color
+	m_renderContext->BeginFrame();
 	m_renderContext->clear();
 
 	// Render all UI widgets through the root container
 	if (m_rootWidgetContainer)
 	{
+		// Lay out whatever moved or changed during the update before drawing it
+		m_rootWidgetContainer->UpdateLayout();
+
+		// Drawing an unchanged widget tree must not allocate (checked with --assert-no-alloc)
+		MEMORY_NO_ALLOC_SCOPE("WidgetContainer::Draw");
 		m_rootWidgetContainer->Draw(*m_renderContext);
 	}
 
-	// Render custom cursor with dual input mode support
-	if (m_cursorTexture.getSize().x > 0) // Ensure cursor texture is loaded
+	// Profiler overlay on top of the UI, below the cursor
+	if (m_profilerHud)
+	{
+		m_profilerHud->Draw(*m_renderContext);
+	}
+
+	// Render custom cursor with dual input mode support; in mouse mode the OS draws the hardware cursor when available
+	bool hardwareCursorShown = m_hardwareCursorLoaded && m_currentInputMode == InputMode::Mouse;
+	if (m_cursorTexture.getSize().x > 0 && !hardwareCursorShown) // Ensure cursor texture is loaded
 	{
 		sf::Vector2f cursorPos;
 
 		if (m_currentInputMode == InputMode::Mouse)
 		{
-			// Mouse mode: use real-time mouse position from system
-			sf::Vector2i mousePos = sf::Mouse::getPosition(*m_renderContext);
+			// Mouse mode: the only cursor query of the frame, taken after the UI is drawn and right
+			// before display() so the sprite lags the real cursor as little as possible.
+			// Headless runs and playback draw it where the script or recording last moved the pointer
+			sf::Vector2i mousePos = m_renderWindow && !m_playback ? sf::Mouse::getPosition(*m_renderWindow) : m_lastMousePosition;
 			cursorPos.x = static_cast<float>(mousePos.x);
 			cursorPos.y = static_cast<float>(mousePos.y);
 		}
@@ -367,24 +1005,67 @@ void Application::DisplayHandle()
 		m_renderContext->draw(m_cursorSprite);
 	}
 
-	// Present completed frame to screen
-	m_renderContext->display();
+	// Present completed frame to screen (or finish the offscreen frame)
+	if (m_renderWindow)
+	{
+		m_renderWindow->display();
+	}
+	else
+	{
+		m_renderTexture->display();
+	}
+	m_renderContext->EndFrame();
+
+	const RenderStats& renderStats = m_renderContext->GetLastFrameStats();
+	TRACE_COUNTER("DrawCalls", renderStats.m_drawCalls);
+	TRACE_COUNTER("TextureChanges", renderStats.m_textureChanges);
 }
 
 /// @brief Processes SFML input events for window and UI interaction
 /// Handles window close events, Escape key shutdown, global time control (+/-), pause/unpause (Space), and forwards UI input to the widget system
-/// Note: Gamepad and mouse movement detection handled separately in UpdateInputMode()
+/// Note: Mouse mode switching is detected here from the coalesced moves, gamepad stick detection in UpdateInputMode()
 void Application::InputHandle()
 {
-	InputEvent event;
-	// Poll all pending SFML events from the window
-	while (m_renderContext->pollEvent(event))
+	PROFILE_SCOPE("InputHandle");
+	MEMORY_TAG_SCOPE(MemoryTag::UI, "InputHandle");
+
+	// Poll all pending SFML events from the window; mouse moves are collapsed to the latest position.
+	// Headless runs and playback have filled the queue from the script or recording instead
+	if (m_playback)
+	{
+		PumpWindowDuringPlayback();
+	}
+	else if (m_renderWindow)
+	{
+		m_inputQueue.Collect(*m_renderWindow);
+	}
+	ReadGamepadState();
+	bool hadInput = !m_inputQueue.GetEvents().empty();
+	m_framePacer.MarkInputPolled(hadInput);
+	if (hadInput)
+	{
+		m_lastInputClock.restart();
+	}
+
+	// Detect mouse movement and switch to Mouse mode if movement detected
+	if (m_inputQueue.HasMouseMoved())
+	{
+		if (m_currentInputMode != InputMode::Mouse)
+		{
+			m_currentInputMode = InputMode::Mouse;
+			UpdateSystemCursor();
+			//DebugLog("Switched to Mouse input mode", DebugType::Message);
+		}
+		m_lastMousePosition = m_inputQueue.GetLastMousePosition();
+	}
+
+	for (const InputEvent& event : m_inputQueue.GetEvents())
 	{
 		if (event.type == InputEvent::Closed ||
 			 (event.type == InputEvent::KeyPressed && event.key.code == sf::Keyboard::Escape))
 		{
 			// User clicked window close button or pressed Escape key - initiate application shutdown
-			m_renderContext->close();
+			RequestClose();
 		}
 		else if (event.type == InputEvent::KeyPressed &&
 						 (event.key.code == sf::Keyboard::Add || event.key.code == sf::Keyboard::Subtract))
@@ -420,6 +1101,41 @@ void Application::InputHandle()
 				DebugLog("Global time multiplier decreased from " + std::to_string(oldMultiplier) + " to " + std::to_string(s_globalTimeMultiplier), DebugType::Message);
 			}
 		}
+		else if (event.type == InputEvent::KeyPressed && event.key.code == sf::Keyboard::F3)
+		{
+			// F3 toggles the frame profiler overlay
+			if (m_profilerHud)
+			{
+				m_profilerHud->SetVisible(!m_profilerHud->IsVisible());
+			}
+		}
+		else if (event.type == InputEvent::KeyPressed && event.key.code == sf::Keyboard::F4)
+		{
+			// F4 prints the allocations per subsystem and the top allocating sites
+			if (MemoryTracker::IsEnabled())
+			{
+				std::ostringstream report;
+				MemoryTracker::Get().WriteReport(report, s_memoryReportSites);
+				DebugLog(report.str());
+			}
+			else
+			{
+				DebugLog("Memory tracking is disabled in this build (MEMORY_TRACKING_ENABLED)", DebugType::Warning);
+			}
+		}
+		else if (event.type == InputEvent::KeyPressed && event.key.code == sf::Keyboard::F9)
+		{
+			// F9 starts a trace capture, or stops and writes the running one at the end of this frame;
+			// stopping here would leave the open frame and update scopes without their end events
+			if (TraceRecorder::Get().IsRecording())
+			{
+				m_traceStopRequested = true;
+			}
+			else
+			{
+				StartTraceCapture();
+			}
+		}
 		else if (event.type == InputEvent::KeyPressed && event.key.code == sf::Keyboard::Space)
 		{
 			// Space key pressed - toggle pause/unpause by setting time multiplier to 0 or restoring previous value
@@ -441,7 +1157,8 @@ void Application::InputHandle()
 		else if (event.type == InputEvent::KeyPressed)
 		{
 			// Test trading hotkeys: 1-5 to buy, Shift+1-5 to sell
-			bool isShiftPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) || sf::Keyboard::isKeyPressed(sf::Keyboard::RShift);
+			// Shift state as delivered with the event, so scripted input can sell too
+			bool isShiftPressed = event.key.shift;
 
 			if (event.key.code >= sf::Keyboard::Num1 && event.key.code <= sf::Keyboard::Num5)
 			{
@@ -467,13 +1184,12 @@ void Application::InputHandle()
 	}
 
 	// Handle gamepad A button press to simulate mouse click
-	if (sf::Joystick::isConnected(m_gamepadId))
+	if (m_gamepad.m_connected)
 	{
-		static bool wasAButtonPressed = false;
-		bool isAButtonPressed = sf::Joystick::isButtonPressed(m_gamepadId, 0); // Button 0 is typically A button
+		bool isAButtonPressed = m_gamepad.m_buttonA;
 
 		// Detect button press (rising edge)
-		if (isAButtonPressed && !wasAButtonPressed)
+		if (isAButtonPressed && !m_wasAButtonPressed)
 		{
 			// Create synthetic mouse click event at current gamepad cursor position
 			InputEvent clickEvent;
@@ -489,7 +1205,7 @@ void Application::InputHandle()
 			}
 		}
 		// Detect button release (falling edge)
-		else if (!isAButtonPressed && wasAButtonPressed)
+		else if (!isAButtonPressed && m_wasAButtonPressed)
 		{
 			// Create synthetic mouse release event
 			InputEvent releaseEvent;
@@ -505,7 +1221,49 @@ void Application::InputHandle()
 			}
 		}
 
-		wasAButtonPressed = isAButtonPressed;
+		m_wasAButtonPressed = isAButtonPressed;
+	}
+}
+
+/// @brief Takes this frame's gamepad snapshot used by all gamepad consumers
+/// Playback replays the recorded state; headless runs have no gamepad
+void Application::ReadGamepadState()
+{
+	if (m_playback)
+	{
+		m_gamepad = m_inputRecording->GetGamepadState(m_inputFrame);
+		return;
+	}
+
+	m_gamepad = GamepadState();
+	if (m_headless || !sf::Joystick::isConnected(m_gamepadId))
+		return;
+
+	m_gamepad.m_connected = true;
+	m_gamepad.m_buttonA = sf::Joystick::isButtonPressed(m_gamepadId, 0); // Button 0 is typically A button
+	m_gamepad.m_axisX = sf::Joystick::getAxisPosition(m_gamepadId, sf::Joystick::X);
+	m_gamepad.m_axisY = sf::Joystick::getAxisPosition(m_gamepadId, sf::Joystick::Y);
+	m_gamepad.m_hasScrollAxis = sf::Joystick::hasAxis(m_gamepadId, sf::Joystick::R);
+	if (m_gamepad.m_hasScrollAxis)
+	{
+		m_gamepad.m_axisScroll = sf::Joystick::getAxisPosition(m_gamepadId, sf::Joystick::R);
+	}
+}
+
+/// @brief Keeps the window responsive while the playback supplies the input
+/// Live events are dropped, except closing the window, which stops the playback
+void Application::PumpWindowDuringPlayback()
+{
+	if (!m_renderWindow)
+		return;
+
+	InputEvent event;
+	while (m_renderWindow->pollEvent(event))
+	{
+		if (event.type == InputEvent::Closed)
+		{
+			RequestClose();
+		}
 	}
 }
 
@@ -607,3 +1365,56 @@ void Application::SetAssetsPath(const char* assetsPath)
 	s_assetsPath = assetsPath;
 }
 
+
+/// @brief Loads the list of textures pre-scaled by the assetBaker tool
+/// Reads asset_bake_report.json from the baked assets folder; when it is missing
+/// every texture is loaded from the original assets folder
+void Application::LoadBakedAssetIndex()
+{
+	MEMORY_TAG_SCOPE(MemoryTag::Loaders, "LoadBakedAssetIndex");
+	STARTUP_PHASE("LoadBakedAssetIndex");
+	MetricTimerScope loadTimer(MetricHistogram::DataLoadSeconds);
+	s_bakedTextures.clear();
+
+	std::string path = s_bakedAssetsPath + "asset_bake_report.json";
+	std::ifstream stream(path);
+	if (!stream.is_open())
+	{
+		DebugLog("No baked assets found, using original textures");
+		return;
+	}
+	StartupAssetScope asset(path, StartupAssetKind::Json);
+	std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	asset.MarkRead(fileData.size());
+
+	Json::Document document;
+	document.Parse(fileData.c_str());
+	if (document.HasParseError() || !document.IsObject() || !document.HasMember("textures") || !document["textures"].IsArray())
+	{
+		asset.Complete(false);
+		DebugLog("Invalid baked asset report, using original textures", DebugType::Warning);
+		return;
+	}
+
+	const Json::Value& textures = document["textures"];
+	for (Json::SizeType i = 0; i < textures.Size(); i++)
+	{
+		if (textures[i].HasMember("file") && textures[i]["file"].IsString())
+		{
+			s_bakedTextures.insert(textures[i]["file"].GetString());
+		}
+	}
+	DebugLog("Baked textures available: " + std::to_string(s_bakedTextures.size()));
+}
+
+/// @brief Resolves the file to load for a texture
+/// @param fileName Texture file name relative to the assets folder
+/// @return Path of the baked copy if one exists, otherwise the original asset path
+std::string Application::ResolveTexturePath(const std::string& fileName)
+{
+	if (s_bakedTextures.count(fileName) != 0)
+	{
+		return s_bakedAssetsPath + fileName;
+	}
+	return s_assetsPath + fileName;
+}
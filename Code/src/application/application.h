@@ -4,11 +4,19 @@
 #include "../framework/WidgetImage.h"
 #include "../framework/WidgetButton.h"
 #include "../framework/WidgetContainer.h"
+#include "../framework/InputQueue.h"
+#include "../framework/FramePacer.h"
+#include "../framework/WidgetProfilerHud.h"
 
 #include "inventory.h"
 #include "utilTools.h"
 #include "applicationUI.h"
+#include "modelChangeBus.h"
+#include "headlessRunner.h"
+#include "inputRecording.h"
+#include "metricsExporter.h"
 #include "pch.h"
+#include <set>
 
 class Inventory;
 class StockMarket; // forward declaration to avoid circular include
@@ -25,6 +33,7 @@ public:
 	Application();
 	~Application();
 
+	void ParseCommandLine(int argc, char* argv[]);
 	void Initialize();
 	void InitializeUI();
 	void InitializeContainersUI();
@@ -32,19 +41,40 @@ public:
 	void UI_DebugContainers();
 	void SetVideoSettings();
 
-	void Run();
+	int Run(); // Returns the process exit code
 	void ApplicationUpdate(sf::Time delta);
 
 	ui::Window* GetMainWindow() const;
 	Inventory* GetPlayerInventory() const;
 	ApplicationUI* GetApplicationUI() const;
+	const ui::FramePacer& GetFramePacer() const { return m_framePacer; }
+	ModelChangeBus* GetModelChangeBus() { return &m_modelChangeBus; }
 
 	static std::string s_dataPath;
 	static std::string s_assetsPath;
+	static std::string s_bakedAssetsPath; // Pre-scaled textures written by the assetBaker tool
+
+	// Returns the baked copy of a texture when one exists, otherwise the original asset path
+	static std::string ResolveTexturePath(const std::string& fileName);
 
 	// Public control flags / speed used by systems (made public)
 	static float s_globalTimeMultiplier; // Global time multiplier for all game systems
 	static float s_previousTimeMultiplier; // Previous time multiplier for pause/unpause functionality
+	static bool s_useHardwareCursor; // Let the OS draw the mouse cursor (software sprite only in gamepad mode)
+
+	// Frame pacing (applied in SetVideoSettings)
+	static unsigned int s_targetFrameRate; // Frames per second while the game runs (0 = unlimited)
+	static unsigned int s_idleFrameRate;   // Frames per second while paused without input
+	static bool s_verticalSync;            // Pace by the display refresh instead of s_targetFrameRate
+
+	// Trace capture (F9 or --trace[=seconds]), written as Chrome trace JSON to the working directory
+	static float s_traceCaptureSeconds;    // Length of a capture unless stopped earlier with F9
+
+	// Allocation report (F4) in builds with MEMORY_TRACKING_ENABLED; --assert-no-alloc checks the hot paths
+	static constexpr size_t s_memoryReportSites = 15; // Call sites listed in the report
+
+	// Startup report printed at the end of Initialize (--startup-report=file also writes it as JSON)
+	static constexpr size_t s_startupReportAssets = 20; // Slowest files listed in the report
 
 	// Shared random number generator
 	static std::mt19937& GetRandomGenerator();
@@ -59,25 +89,71 @@ public:
 private:
 	void SetDataPath(const char* dataPath);
 	void SetAssetsPath(const char* assetsPath);
+	void LoadBakedAssetIndex();
 
 	void SetupInventory();
 	void SetupStockMarket();
 	void SetupCustomCursor();
+	bool LoadHardwareCursor(const std::string& cursorPath);
+	void UpdateSystemCursor();
 
 	void TotalGameTimeUpdate(sf::Time& delta);
 	void UpdateInputMode();
 	void UpdateGamepadCursor(sf::Time delta);
+	float GetGamepadScrollAxis() const;
 
 	void DisplayHandle();
 	void InputHandle();
+	void RequestClose();
+	int RunHeadless();
+	void SettleHeadlessFrame();
+	void ReadGamepadState();
+	void PumpWindowDuringPlayback();
+	int FinishInputRecording(sf::Time recordedTime, sf::Time wallTime);
+	bool IsIdle() const;
+	void ReportInputLatency();
+	void ReportStartupTimeline();
+	void StartTraceCapture();
+	void StopTraceCapture();
 	void HandleTestTrading(sf::Keyboard::Key key, bool isShiftPressed);
 
 	std::unique_ptr< ui::Window > m_mainWindow;
-	std::unique_ptr< RenderContext > m_renderContext;
+	sf::Cursor m_hardwareCursor; // Declared before the window, which must release it first
+	std::unique_ptr< sf::RenderWindow > m_renderWindow;
+	std::unique_ptr< sf::RenderTexture > m_renderTexture; // Replaces m_renderWindow in headless runs
+	std::unique_ptr< RenderContext > m_renderContext; // Draws into m_renderWindow (or m_renderTexture) and counts what is submitted
+	ui::InputQueue m_inputQueue; // Window events of the current frame, mouse moves coalesced
+	ui::FramePacer m_framePacer; // Frame rate limiting and input latency statistics
+	sf::Clock m_lastInputClock;  // Restarted whenever the window delivers events
+	sf::Clock m_latencyReportClock;
+	bool m_traceOnStart; // --trace: capture from the first frame of Run
+	bool m_traceStopRequested; // F9 during a capture; stopped between frames so the last frame is complete
+	bool m_closeRequested; // Escape or window close; ends the main loop
+
+	// Headless run (--headless[=script]): offscreen rendering at a fixed frame time, see HeadlessRunner
+	bool m_headless;
+	HeadlessSettings m_headlessSettings;
+	std::unique_ptr<HeadlessRunner> m_headlessRunner; // Created in Initialize, null if the script failed to load
+
+	// Input recording (--record=file) and deterministic playback (--playback=file, --playback-fast), see InputRecording
+	std::string m_recordPath;
+	std::string m_playbackPath;
+	bool m_playback;         // m_inputRecording is played back instead of reading the window and gamepad
+	bool m_playbackFast;     // Play back as fast as possible, without drawing
+	std::unique_ptr<InputRecording> m_inputRecording; // Created in Initialize, null without (or after a failed) --record/--playback
+	uint32_t m_inputFrame;   // Frame of the recording being recorded or played back
+	uint32_t m_divergedFrame; // First frame whose time multiplier differed from the recording (UINT32_MAX: none)
+
+	// Metrics export (--metrics-port=N, --metrics-file=path), see MetricsExporter
+	MetricsExportSettings m_metricsSettings;
+	std::unique_ptr<MetricsExporter> m_metricsExporter; // Created in Initialize when a port or file is set
+
+	std::string m_startupReportPath; // --startup-report=file, see StartupTimeline
 
 	// Custom cursor
 	sf::Texture m_cursorTexture; // Texture for custom cursor
 	sf::Sprite m_cursorSprite;   // Sprite for custom cursor
+	bool m_hardwareCursorLoaded; // m_hardwareCursor holds the custom cursor image
 
 	// Input mode handling
 	enum class InputMode { Mouse, Gamepad };
@@ -86,9 +162,15 @@ private:
 	sf::Vector2i m_lastMousePosition;          // Last recorded mouse position
 	float m_gamepadCursorSpeed;                // Speed multiplier for gamepad cursor movement
 	unsigned int m_gamepadId;                  // ID of the connected gamepad (0-7)
+	GamepadState m_gamepad;                    // Read once per frame in InputHandle (or from the playback)
+	bool m_wasAButtonPressed;                  // A button state of the previous frame, for click edges
+
+	// Model to UI change notifications, drained once per frame in ApplicationUpdate
+	ModelChangeBus m_modelChangeBus;
 
 	// Static variables
 	static float s_totalGameTime; // Total game time in seconds (double precision)
+	static std::set<std::string> s_bakedTextures; // Texture files available in s_bakedAssetsPath
 
 	// UI variables
 	std::unique_ptr<ApplicationUI> m_applicationUI; // UI management class
@@ -96,5 +178,6 @@ private:
 	ui::WidgetContainer* m_monitorMenuContainer; // Pointer to monitor menu container (owned by root)
 	ui::WidgetContainer* m_monitor1Container; // Pointer to monitor 1 container (owned by applicationUI)
 	ui::WidgetText* m_gameTimeText; // Pointer to game time text widget (owned by container)
+	std::unique_ptr<ui::WidgetProfilerHud> m_profilerHud; // Frame profiler overlay (F3), drawn above the root container
 };
 
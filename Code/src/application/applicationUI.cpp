@@ -8,6 +8,7 @@
 #include "pch.h"
 #include "application.h" // Aggregates required widget headers
 #include "applicationUI.h"
+#include "../framework/TextureCache.h"
 #include <algorithm>
 #include <sstream>
 #include <sstream>
@@ -43,6 +44,7 @@ ApplicationUI::ApplicationUI()
 	, m_energyProgressBar(nullptr)
 	, m_volumeText(nullptr)
 	, m_volumeProgressBar(nullptr)
+	, m_inventoryList(nullptr)
 	, m_productInfoImage(nullptr)
 	, m_productInfoText(nullptr)
 	, m_productVolumeText(nullptr)
@@ -103,6 +105,7 @@ ApplicationUI::ApplicationUI()
 ///          - Performing final layout calculations for proper widget positioning
 void ApplicationUI::InitializeUI(Application* app)
 {
+	STARTUP_PHASE("InitializeUI");
 	// Store application reference for accessing stock market and inventory data
 	m_application = app;
 
@@ -130,6 +133,7 @@ void ApplicationUI::InitializeUI(Application* app)
 ///          7. Debug visualization (development aid)
 void ApplicationUI::InitializeContainersUI()
 {
+	STARTUP_PHASE("InitializeContainersUI");
 	// Create the main UI hierarchy in proper dependency order
 	UI_InitializeRootContainer();          // Full-screen root container with background
 	UI_InitializeGameTimeWidget();         // Digital time display with custom font (loads fonts first)
@@ -156,8 +160,10 @@ void ApplicationUI::InitializeContainersUI()
 ///          visual hierarchy. Z-order: background image (bottom) -> title text -> other containers
 void ApplicationUI::UI_InitializeRootContainer()
 {
+	STARTUP_PHASE("UI_InitializeRootContainer");
 	// Create full-screen root container to hold all UI elements
 	m_rootContainer = std::make_unique<ui::WidgetContainer>(0, 0, 1920, 1080);
+	m_rootContainer->EnableHitGrid(64); // Route mouse events through a 64px spatial grid instead of the whole tree
 
 	// Add background image that fills the entire screen (rendered first, at bottom Z-order)
 	auto imageWidget = std::make_unique<ui::WidgetImage>(0, 0, 1920, 1080, "BgInit.png");
@@ -172,7 +178,8 @@ void ApplicationUI::UI_InitializeRootContainer()
 	m_rootContainer->AddWidget(std::move(titleText));
 
 	std::string fontPath = Application::s_assetsPath + "FontLedNews.ttf";
-	if (m_ledFont.loadFromFile(fontPath))
+	StartupAssetScope fontAsset(fontPath, StartupAssetKind::Font);
+	if (fontAsset.Complete(m_ledFont.loadFromFile(fontPath)))
 	{
 
 		// Add rolling text 1 - full width at very top of screen
@@ -228,6 +235,7 @@ void ApplicationUI::UI_InitializeRootContainer()
 ///          Products: TRI (Tritanium), NFX (Neuroflux), ZER (Zeromass), LUM (Lumirite), NAN (Nanochip)
 void ApplicationUI::UI_InitializeMonitorMenuContainer()
 {
+	STARTUP_PHASE("UI_InitializeMonitorMenuContainer");
 	// Create main container for all 5 trading monitors (positioned below title, above other UI)
 	auto menuMonitorContainer = std::make_unique<ui::WidgetContainer>(0, 200, 1920, 380);
 	menuMonitorContainer->SetLayout(ui::LayoutType::Native);  // Manual positioning for precise control
@@ -247,6 +255,9 @@ void ApplicationUI::UI_InitializeMonitorMenuContainer()
 	ButtonMonitor1->SetOnClickCallback([this]() {
 		SelectMonitor(0); // Call SelectMonitor instead of direct product ID setting
 		});
+	ButtonMonitor1->SetOnHoverCallback([this]() {
+		PrefetchMonitorImages(0); // Start decoding portrait and logo before the click
+		});
 	m_monitorButtons[0] = ButtonMonitor1.get(); // Store button reference
 	m_monitor1Container->AddWidget(std::move(ButtonMonitor1));
 
@@ -269,6 +280,9 @@ void ApplicationUI::UI_InitializeMonitorMenuContainer()
 	ButtonMonitor2->SetOnClickCallback([this]() {
 		SelectMonitor(1); // Call SelectMonitor instead of direct product ID setting
 		});
+	ButtonMonitor2->SetOnHoverCallback([this]() {
+		PrefetchMonitorImages(1); // Start decoding portrait and logo before the click
+		});
 	m_monitorButtons[1] = ButtonMonitor2.get(); // Store button reference
 	m_monitor2Container->AddWidget(std::move(ButtonMonitor2));
 
@@ -290,6 +304,9 @@ void ApplicationUI::UI_InitializeMonitorMenuContainer()
 	ButtonMonitor3->SetOnClickCallback([this]() {
 		SelectMonitor(2); // Call SelectMonitor instead of direct product ID setting
 		});
+	ButtonMonitor3->SetOnHoverCallback([this]() {
+		PrefetchMonitorImages(2); // Start decoding portrait and logo before the click
+		});
 	m_monitorButtons[2] = ButtonMonitor3.get(); // Store button reference
 	m_monitor3Container->AddWidget(std::move(ButtonMonitor3));
 
@@ -311,6 +328,9 @@ void ApplicationUI::UI_InitializeMonitorMenuContainer()
 	ButtonMonitor4->SetOnClickCallback([this]() {
 		SelectMonitor(3); // Call SelectMonitor instead of direct product ID setting
 		});
+	ButtonMonitor4->SetOnHoverCallback([this]() {
+		PrefetchMonitorImages(3); // Start decoding portrait and logo before the click
+		});
 	m_monitorButtons[3] = ButtonMonitor4.get(); // Store button reference
 	m_monitor4Container->AddWidget(std::move(ButtonMonitor4));
 
@@ -332,6 +352,9 @@ void ApplicationUI::UI_InitializeMonitorMenuContainer()
 	ButtonMonitor5->SetOnClickCallback([this]() {
 		SelectMonitor(4); // Call SelectMonitor instead of direct product ID setting
 		});
+	ButtonMonitor5->SetOnHoverCallback([this]() {
+		PrefetchMonitorImages(4); // Start decoding portrait and logo before the click
+		});
 	m_monitorButtons[4] = ButtonMonitor5.get(); // Store button reference
 	m_monitor5Container->AddWidget(std::move(ButtonMonitor5));
 
@@ -348,6 +371,7 @@ void ApplicationUI::UI_InitializeMonitorMenuContainer()
 ///          Position: center of screen with horizontal layout
 void ApplicationUI::UI_InitializeTradeContainer()
 {
+	STARTUP_PHASE("UI_InitializeTradeContainer");
 	// Create trade container for action buttons (positioned in middle of screen)
 	auto tradeContainer = std::make_unique<ui::WidgetContainer>(600, 600, 720, 720);
 	tradeContainer->SetLayout(ui::LayoutType::Native, 20); // Horizontal layout with 20px spacing
@@ -570,6 +594,7 @@ void ApplicationUI::UI_InitializeTradeContainer()
 ///          Position: bottom left corner of the screen
 void ApplicationUI::UI_InitializeInventoryContainer()
 {
+	STARTUP_PHASE("UI_InitializeInventoryContainer");
 	// Create inventory container in bottom left corner (400x300 pixels)
 	auto inventoryContainer = std::make_unique<ui::WidgetContainer>(30, 600, 550, 400);
 	inventoryContainer->SetLayout(ui::LayoutType::Native); // Manual positioning for precise control
@@ -588,175 +613,19 @@ void ApplicationUI::UI_InitializeInventoryContainer()
 	inventoryTitle->SetTextColor(sf::Color::White);
 	m_inventoryContainer->AddWidget(std::move(inventoryTitle));
 
-	// Create vertical container for inventory products
-	auto inventoryProductsContainer = std::make_unique<ui::WidgetContainer>(10, 70, 530, 250);
-	inventoryProductsContainer->SetLayout(ui::LayoutType::Vertical, 5); // Vertical layout with 5px spacing
-	m_inventoryProductsContainer = inventoryProductsContainer.get();
-	m_inventoryContainer->AddWidget(std::move(inventoryProductsContainer));
-
-	// === Inventory Button 1 ===
-	auto inventoryButton1Container = std::make_unique<ui::WidgetContainer>(0, 0, 530, 45);
-	inventoryButton1Container->SetLayout(ui::LayoutType::Native); // Manual positioning for precise control
-	m_inventoryButton1Container = inventoryButton1Container.get();
-	m_inventoryProductsContainer->AddWidget(std::move(inventoryButton1Container));
-
-	// Button 1 background button
-	auto inventoryButton1 = std::make_unique<ui::WidgetButton>(0, 0, 530, 45);
-	inventoryButton1->LoadImage("BgInventory.png");
-	inventoryButton1->SetOnClickCallback([this]() {
-		SelectInventoryItemMonitor(0);
-	});
-	m_inventoryButton1 = inventoryButton1.get();
-	m_inventoryButton1Container->AddWidget(std::move(inventoryButton1));
-
-	// Button 1 product image (left side)
-	auto inventoryButton1ProductImage = std::make_unique<ui::WidgetImage>(20, 7, 30, 30, "IconMaterialTritanium.png");
-	m_inventoryButton1ProductImage = inventoryButton1ProductImage.get();
-	m_inventoryButton1Container->AddWidget(std::move(inventoryButton1ProductImage));
-
-	// Button 1 volume text (middle)
-	auto inventoryButton1VolumeText = std::make_unique<ui::WidgetText>(200, 12, "NA");
-	inventoryButton1VolumeText->SetCharacterSize(14);
-	inventoryButton1VolumeText->SetTextColor(sf::Color::Cyan);
-	inventoryButton1VolumeText->SetStyle(sf::Text::Bold);
-	m_inventoryButton1VolumeText = inventoryButton1VolumeText.get();
-	m_inventoryButton1Container->AddWidget(std::move(inventoryButton1VolumeText));
-
-	// Button 1 quantity text (right side)
-	auto inventoryButton1QuantityText = std::make_unique<ui::WidgetText>(450, 12, "NA");
-	inventoryButton1QuantityText->SetCharacterSize(14);
-	inventoryButton1QuantityText->SetTextColor(sf::Color::Yellow);
-	inventoryButton1QuantityText->SetStyle(sf::Text::Bold);
-	m_inventoryButton1QuantityText = inventoryButton1QuantityText.get();
-	m_inventoryButton1Container->AddWidget(std::move(inventoryButton1QuantityText));
-
-	// === Inventory Button 2 ===
-	auto inventoryButton2Container = std::make_unique<ui::WidgetContainer>(0, 0, 530, 45);
-	inventoryButton2Container->SetLayout(ui::LayoutType::Native);
-	m_inventoryButton2Container = inventoryButton2Container.get();
-	m_inventoryProductsContainer->AddWidget(std::move(inventoryButton2Container));
-
-	auto inventoryButton2 = std::make_unique<ui::WidgetButton>(0, 0, 530, 45);
-	inventoryButton2->LoadImage("BgInventory.png");
-	inventoryButton2->SetOnClickCallback([this]() {
-		SelectInventoryItemMonitor(1);
-	});
-	m_inventoryButton2 = inventoryButton2.get();
-	m_inventoryButton2Container->AddWidget(std::move(inventoryButton2));
-
-	auto inventoryButton2ProductImage = std::make_unique<ui::WidgetImage>(20, 7, 30, 30, "IconMaterialNeuro.png");
-	m_inventoryButton2ProductImage = inventoryButton2ProductImage.get();
-	m_inventoryButton2Container->AddWidget(std::move(inventoryButton2ProductImage));
-
-	auto inventoryButton2VolumeText = std::make_unique<ui::WidgetText>(200, 12, "NA");
-	inventoryButton2VolumeText->SetCharacterSize(14);
-	inventoryButton2VolumeText->SetTextColor(sf::Color::Cyan);
-	inventoryButton2VolumeText->SetStyle(sf::Text::Bold);
-	m_inventoryButton2VolumeText = inventoryButton2VolumeText.get();
-	m_inventoryButton2Container->AddWidget(std::move(inventoryButton2VolumeText));
-
-	auto inventoryButton2QuantityText = std::make_unique<ui::WidgetText>(450, 12, "NA");
-	inventoryButton2QuantityText->SetCharacterSize(14);
-	inventoryButton2QuantityText->SetTextColor(sf::Color::Yellow);
-	inventoryButton2QuantityText->SetStyle(sf::Text::Bold);
-	m_inventoryButton2QuantityText = inventoryButton2QuantityText.get();
-	m_inventoryButton2Container->AddWidget(std::move(inventoryButton2QuantityText));
-
-	// === Inventory Button 3 ===
-	auto inventoryButton3Container = std::make_unique<ui::WidgetContainer>(0, 0, 530, 45);
-	inventoryButton3Container->SetLayout(ui::LayoutType::Native);
-	m_inventoryButton3Container = inventoryButton3Container.get();
-	m_inventoryProductsContainer->AddWidget(std::move(inventoryButton3Container));
-
-	auto inventoryButton3 = std::make_unique<ui::WidgetButton>(0, 0, 530, 45);
-	inventoryButton3->LoadImage("BgInventory.png");
-	inventoryButton3->SetOnClickCallback([this]() {
-		SelectInventoryItemMonitor(2);
-	});
-	m_inventoryButton3 = inventoryButton3.get();
-	m_inventoryButton3Container->AddWidget(std::move(inventoryButton3));
-
-	auto inventoryButton3ProductImage = std::make_unique<ui::WidgetImage>(20, 7, 30, 30, "IconMaterialZeromass.png");
-	m_inventoryButton3ProductImage = inventoryButton3ProductImage.get();
-	m_inventoryButton3Container->AddWidget(std::move(inventoryButton3ProductImage));
-
-	auto inventoryButton3VolumeText = std::make_unique<ui::WidgetText>(200, 12, "NA");
-	inventoryButton3VolumeText->SetCharacterSize(14);
-	inventoryButton3VolumeText->SetTextColor(sf::Color::Cyan);
-	inventoryButton3VolumeText->SetStyle(sf::Text::Bold);
-	m_inventoryButton3VolumeText = inventoryButton3VolumeText.get();
-	m_inventoryButton3Container->AddWidget(std::move(inventoryButton3VolumeText));
-
-	auto inventoryButton3QuantityText = std::make_unique<ui::WidgetText>(450, 12, "NA");
-	inventoryButton3QuantityText->SetCharacterSize(14);
-	inventoryButton3QuantityText->SetTextColor(sf::Color::Yellow);
-	inventoryButton3QuantityText->SetStyle(sf::Text::Bold);
-	m_inventoryButton3QuantityText = inventoryButton3QuantityText.get();
-	m_inventoryButton3Container->AddWidget(std::move(inventoryButton3QuantityText));
-
-	// === Inventory Button 4 ===
-	auto inventoryButton4Container = std::make_unique<ui::WidgetContainer>(0, 0, 530, 45);
-	inventoryButton4Container->SetLayout(ui::LayoutType::Native);
-	m_inventoryButton4Container = inventoryButton4Container.get();
-	m_inventoryProductsContainer->AddWidget(std::move(inventoryButton4Container));
-
-	auto inventoryButton4 = std::make_unique<ui::WidgetButton>(0, 0, 530, 45);
-	inventoryButton4->LoadImage("BgInventory.png");
-	inventoryButton4->SetOnClickCallback([this]() {
-		SelectInventoryItemMonitor(3);
+	// Create the scrolling inventory list (45px rows with 5px spacing). Only the rows that fit
+	// are created; they are rebound to other inventory items while scrolling
+	auto inventoryList = std::make_unique<ui::WidgetListView>(10, 70, 530, 250, 45, 5);
+	m_inventoryList = inventoryList.get();
+	m_inventoryContainer->AddWidget(std::move(inventoryList));
+
+	m_inventoryRows.clear();
+	m_inventoryList->SetRowFactory([this](size_t slot) {
+		return CreateInventoryRow(slot);
 	});
-	m_inventoryButton4 = inventoryButton4.get();
-	m_inventoryButton4Container->AddWidget(std::move(inventoryButton4));
-
-	auto inventoryButton4ProductImage = std::make_unique<ui::WidgetImage>(20, 7, 30, 30, "IconMaterialLumi.png");
-	m_inventoryButton4ProductImage = inventoryButton4ProductImage.get();
-	m_inventoryButton4Container->AddWidget(std::move(inventoryButton4ProductImage));
-
-	auto inventoryButton4VolumeText = std::make_unique<ui::WidgetText>(200, 12, "NA");
-	inventoryButton4VolumeText->SetCharacterSize(14);
-	inventoryButton4VolumeText->SetTextColor(sf::Color::Cyan);
-	inventoryButton4VolumeText->SetStyle(sf::Text::Bold);
-	m_inventoryButton4VolumeText = inventoryButton4VolumeText.get();
-	m_inventoryButton4Container->AddWidget(std::move(inventoryButton4VolumeText));
-
-	auto inventoryButton4QuantityText = std::make_unique<ui::WidgetText>(450, 12, "NA");
-	inventoryButton4QuantityText->SetCharacterSize(14);
-	inventoryButton4QuantityText->SetTextColor(sf::Color::Yellow);
-	inventoryButton4QuantityText->SetStyle(sf::Text::Bold);
-	m_inventoryButton4QuantityText = inventoryButton4QuantityText.get();
-	m_inventoryButton4Container->AddWidget(std::move(inventoryButton4QuantityText));
-
-	// === Inventory Button 5 ===
-	auto inventoryButton5Container = std::make_unique<ui::WidgetContainer>(0, 0, 530, 45);
-	inventoryButton5Container->SetLayout(ui::LayoutType::Native);
-	m_inventoryButton5Container = inventoryButton5Container.get();
-	m_inventoryProductsContainer->AddWidget(std::move(inventoryButton5Container));
-
-	auto inventoryButton5 = std::make_unique<ui::WidgetButton>(0, 0, 530, 45);
-	inventoryButton5->LoadImage("BgInventory.png");
-	inventoryButton5->SetOnClickCallback([this]() {
-		SelectInventoryItemMonitor(4);
+	m_inventoryList->SetRowBinder([this](size_t slot, size_t itemIndex) {
+		BindInventoryRow(slot, itemIndex);
 	});
-	m_inventoryButton5 = inventoryButton5.get();
-	m_inventoryButton5Container->AddWidget(std::move(inventoryButton5));
-
-	auto inventoryButton5ProductImage = std::make_unique<ui::WidgetImage>(20, 7, 30, 30, "IconMaterialNano.png");
-	m_inventoryButton5ProductImage = inventoryButton5ProductImage.get();
-	m_inventoryButton5Container->AddWidget(std::move(inventoryButton5ProductImage));
-
-	auto inventoryButton5VolumeText = std::make_unique<ui::WidgetText>(200, 12, "NA");
-	inventoryButton5VolumeText->SetCharacterSize(14);
-	inventoryButton5VolumeText->SetTextColor(sf::Color::Cyan);
-	inventoryButton5VolumeText->SetStyle(sf::Text::Bold);
-	m_inventoryButton5VolumeText = inventoryButton5VolumeText.get();
-	m_inventoryButton5Container->AddWidget(std::move(inventoryButton5VolumeText));
-
-	auto inventoryButton5QuantityText = std::make_unique<ui::WidgetText>(450, 12, "NA");
-	inventoryButton5QuantityText->SetCharacterSize(14);
-	inventoryButton5QuantityText->SetTextColor(sf::Color::Yellow);
-	inventoryButton5QuantityText->SetStyle(sf::Text::Bold);
-	m_inventoryButton5QuantityText = inventoryButton5QuantityText.get();
-	m_inventoryButton5Container->AddWidget(std::move(inventoryButton5QuantityText));
 
 	// Add volume text
 	auto volumeText = std::make_unique<ui::WidgetText>(270, 330, "Volume");
@@ -793,6 +662,7 @@ void ApplicationUI::UI_InitializeInventoryContainer()
 ///          Position: Above the inventory container (bottom left area)
 void ApplicationUI::UI_InitializeInventorySortSelector()
 {
+	STARTUP_PHASE("UI_InitializeInventorySortSelector");
 	// Create inventory sort selector container (small horizontal container above inventory)
 	auto inventorySortSelectorContainer = std::make_unique<ui::WidgetContainer>(30, 550, 550, 50);
 	inventorySortSelectorContainer->SetLayout(ui::LayoutType::Native); // Manual positioning for precise control
@@ -841,6 +711,7 @@ void ApplicationUI::UI_InitializeInventorySortSelector()
 ///          Position: bottom right corner of the screen
 void ApplicationUI::UI_InitializeProductInfoContainer()
 {
+	STARTUP_PHASE("UI_InitializeProductInfoContainer");
  // Create product info container in bottom right corner (550x450 pixels)
  auto productInfoContainer = std::make_unique<ui::WidgetContainer>(1340, 600, 550, 450);
  productInfoContainer->SetLayout(ui::LayoutType::Native); // Manual positioning for precise control
@@ -908,6 +779,7 @@ void ApplicationUI::UI_InitializeProductInfoContainer()
 ///         Position: bottom right corner of the screen (same as product info)
 void ApplicationUI::UI_InitializeCompanyInfoContainer()
 {
+	STARTUP_PHASE("UI_InitializeCompanyInfoContainer");
 	// Create company info container in bottom right corner (550x450 pixels)
 	auto productInfoContainer = std::make_unique<ui::WidgetContainer>(1340, 600, 550, 450);
 	productInfoContainer->SetLayout(ui::LayoutType::Native); // Manual positioning for precise control
@@ -943,7 +815,7 @@ void ApplicationUI::UI_InitializeCompanyInfoContainer()
 	m_companyInfoContainer->AddWidget(std::move(companyInfoText));
 
 	// Add company logo image
-	auto companyLogo = std::make_unique<ui::WidgetImage>(300, 120, 200, 150, "Lumacore.png");
+	auto companyLogo = std::make_unique<ui::WidgetImage>(300, 120, 200, 150, ""); // Loaded on monitor selection
 	m_companyLogo = companyLogo.get();
 	m_companyInfoContainer->AddWidget(std::move(companyLogo));
 
@@ -959,6 +831,7 @@ void ApplicationUI::UI_InitializeCompanyInfoContainer()
 ///          Position: bottom right corner of the screen (same as company info)
 void ApplicationUI::UI_InitializeVendorInfoContainer()
 {
+	STARTUP_PHASE("UI_InitializeVendorInfoContainer");
 		// Create vendor info container in bottom right corner (550x450 pixels)
 		auto vendorInfoContainer = std::make_unique<ui::WidgetContainer>(1340, 600, 550, 450);
 		vendorInfoContainer->SetLayout(ui::LayoutType::Native); // Manual positioning for precise control
@@ -978,7 +851,7 @@ void ApplicationUI::UI_InitializeVendorInfoContainer()
 		m_vendorInfoContainer->AddWidget(std::move(vendorInfoTitle));
 
 		// Add vendor character image
-		auto vendorImage = std::make_unique<ui::WidgetImage>(300, 80, 200, 300, "CharacterNano.png");
+		auto vendorImage = std::make_unique<ui::WidgetImage>(300, 80, 200, 300, ""); // Loaded on monitor selection
 		m_vendorImage = vendorImage.get();
 		m_vendorInfoContainer->AddWidget(std::move(vendorImage));
 
@@ -1016,6 +889,7 @@ void ApplicationUI::UI_InitializeVendorInfoContainer()
 ///          Position: Above the info containers (bottom right area)
 void ApplicationUI::UI_InitializeInfoPanelSelector()
 {
+	STARTUP_PHASE("UI_InitializeInfoPanelSelector");
 	// Create info panel selector container (small horizontal container above info panels)
 	auto infoPanelSelectorContainer = std::make_unique<ui::WidgetContainer>(1340, 550, 550, 50);
 	infoPanelSelectorContainer->SetLayout(ui::LayoutType::Native); // Manual positioning for precise control
@@ -1078,9 +952,11 @@ void ApplicationUI::UI_InitializeInfoPanelSelector()
 ///          Position: (1800, 100) - top right area of screen
 void ApplicationUI::UI_InitializeGameTimeWidget()
 {
+	STARTUP_PHASE("UI_InitializeGameTimeWidget");
 	// Attempt to load custom digital font for game time display
 	std::string fontPath = Application::s_assetsPath + "FontDigitalNumbers.ttf";
-	if (m_digitalFont.loadFromFile(fontPath))
+	StartupAssetScope fontAsset(fontPath, StartupAssetKind::Font);
+	if (fontAsset.Complete(m_digitalFont.loadFromFile(fontPath)))
 	{
 		// Create game time text with digital font (preferred)
 		auto gameTimeText = std::make_unique<ui::WidgetText>(1800, 100, "GametimeInitText");
@@ -1111,6 +987,7 @@ void ApplicationUI::UI_InitializeGameTimeWidget()
 ///          Position: (20, 20) - top left corner with small margin
 void ApplicationUI::UI_InitializeLogo()
 {
+	STARTUP_PHASE("UI_InitializeLogo");
 	// Create logo image widget in top left corner
 	auto logoImage = std::make_unique<ui::WidgetImage>(20, -20, 300, 300, "Logo.png");
 
@@ -1130,6 +1007,7 @@ void ApplicationUI::UI_InitializeLogo()
 ///          All widgets are positioned relative to their parent monitor containers
 void ApplicationUI::UI_InitializeImageWidgets()
 {
+	STARTUP_PHASE("UI_InitializeImageWidgets");
 	// === MATERIAL ICONS SECTION ===
 	// Create 64x64 pixel material icons for each tradeable resource, positioned at (80,80) in each monitor
 	auto iconTritanium = std::make_unique<ui::WidgetImage>(80, 60, 130, 130, "IconMaterialTritanium.png");
@@ -1274,9 +1152,9 @@ void ApplicationUI::UI_DebugContainers()
 	if (m_inventoryContainer)
 		m_inventoryContainer->EnableDebugDraw(true, sf::Color(255, 0, 255, 255)); // Magenta opaque
 
-	// Inventory products container debug (green border)
-	if (m_inventoryProductsContainer)
-		m_inventoryProductsContainer->EnableDebugDraw(true, sf::Color(0, 255, 0, 255)); // Green opaque
+	// Inventory list debug (green border)
+	if (m_inventoryList)
+		m_inventoryList->EnableDebugDraw(true, sf::Color(0, 255, 0, 255)); // Green opaque
 
 	// Inventory sort selector container debug (blue border)
 	if (m_inventorySortSelectorContainer)
@@ -1298,6 +1176,7 @@ void ApplicationUI::UI_DebugContainers()
 // Initialize progress bars for cycle, etc.
 void ApplicationUI::UI_InitializeProgressBars()
 {
+	STARTUP_PHASE("UI_InitializeProgressBars");
 	// Create Cycle Progress Bar (orange theme) with "CYCLE" suffix - positioned at top center (2x size)
 	auto cycleProgressBar = std::make_unique<ui::WidgetProgressBar>(630, 150, 720, 25, " CYCLE");
 	cycleProgressBar->SetForegroundColor(sf::Color(255, 165, 0));  // Orange
@@ -1316,6 +1195,8 @@ void ApplicationUI::UI_InitializeProgressBars()
 	m_rootContainer->AddWidget(std::move(cycleProgressBar));
 }
 
+const char* const ApplicationUI::s_monitorProductIds[5] = { "TRI", "NFX", "ZER", "LUM", "NAN" };
+
 /// @brief Update all product displays with current stock market data
 /// @details This function refreshes all 5 trading monitors with real-time data from the stock market:
 ///          - Product names (TRI, NFX, ZER, LUM, NAN)
@@ -1324,56 +1205,112 @@ void ApplicationUI::UI_InitializeProgressBars()
 ///          - Trend arrows (up/down) based on price movement direction
 ///
 ///          Color coding: Green text + up arrow = rising prices, Red text + down arrow = falling prices
-///          Called automatically during UI initialization and by stock market cycle updates
+///          Called during UI initialization; later changes arrive through ApplyModelChanges
 void ApplicationUI::UpdateProductDisplays()
+{
+	const uint32_t allFields = static_cast<uint32_t>(ProductField::Quantity) | static_cast<uint32_t>(ProductField::Price)
+		| static_cast<uint32_t>(ProductField::Trend) | static_cast<uint32_t>(ProductField::Definition);
+
+	// Update each of the 5 trading monitors
+	for (int i = 0; i < 5; ++i)
+	{
+		// Products are never removed or reordered at runtime, so the index stays valid
+		if (m_application && m_application->m_stockMarket)
+		{
+			m_monitorProductIndices[i] = m_application->m_stockMarket->GetStockProductIndex(s_monitorProductIds[i]);
+		}
+		UpdateProductDisplay(i, allFields);
+	}
+}
+
+/// @brief Update the widgets of one trading monitor that show the given product fields
+/// @param monitorIndex Monitor index (0-4)
+/// @param fields ProductField bits to refresh
+void ApplicationUI::UpdateProductDisplay(int monitorIndex, uint32_t fields)
 {
 	// Safety check: ensure we have valid application and stock market references
-	if (!m_application || !m_application->m_stockMarket)
+	if (!m_application || !m_application->m_stockMarket || monitorIndex < 0 || monitorIndex >= 5)
 		return;
 
-	// Product IDs corresponding to each monitor (TRI=Tritanium, NFX=Neuroflux, ZER=Zeromass, LUM=Lumirite, NAN=Nanochip)
-	std::string productIds[5] = { "TRI", "NFX", "ZER", "LUM", "NAN" };
+	// Fetch current product data from stock market system
+	const int i = monitorIndex;
+	StockProduct* product = m_application->m_stockMarket->GetStockProductById(s_monitorProductIds[i]);
 
-	// Update each of the 5 trading monitors
-	for (int i = 0; i < 5; ++i)
+	// Ensure we have valid product data and all required text widgets exist
+	if (!product || !m_txtProd[i] || !m_txtProdQuantity[i] || !m_txtProdPrice[i])
+		return;
+
+	// Display product name (e.g., "Tritanium Ore", "Neuroflux")
+	if (fields & static_cast<uint32_t>(ProductField::Definition))
 	{
-		// Fetch current product data from stock market system
-		StockProduct* product = m_application->m_stockMarket->GetStockProductById(productIds[i]);
+		m_txtProd[i]->SetText(product->m_name);
+	}
 
-		// Ensure we have valid product data and all required text widgets exist
-		if (product && m_txtProd[i] && m_txtProdQuantity[i] && m_txtProdPrice[i])
-		{
-			// Display product name (e.g., "Tritanium Ore", "Neuroflux")
-			m_txtProd[i]->SetText(product->m_name);
+	// Display current stock quantity vs maximum capacity (e.g., "150/500")
+	if (fields & static_cast<uint32_t>(ProductField::Quantity))
+	{
+		std::string quantityText = std::to_string(product->m_quantity) + "/" + std::to_string(product->m_maxQuantity);
+		m_txtProdQuantity[i]->SetText(quantityText);
+	}
 
-			// Display current stock quantity vs maximum capacity (e.g., "150/500")
-			std::string quantityText = std::to_string(product->m_quantity) + "/" + std::to_string(product->m_maxQuantity);
-			m_txtProdQuantity[i]->SetText(quantityText);
+	// Display current price (will be colored based on trend direction)
+	if (fields & static_cast<uint32_t>(ProductField::Price))
+	{
+		std::string priceText = std::to_string(product->m_currentPrice);
+		m_txtProdPrice[i]->SetText(priceText);
+	}
 
-			// Display current price (will be colored based on trend direction)
-			std::string priceText = std::to_string(product->m_currentPrice);
-			m_txtProdPrice[i]->SetText(priceText);
+	// Update visual trend indicators based on price movement direction
+	if ((fields & static_cast<uint32_t>(ProductField::Trend)) && m_imageTrendArrowUp[i] && m_imageTrendArrowDown[i])
+	{
+		if (product->m_trendIncreased)
+		{
+			// Price is rising: show green text with up arrow
+			m_imageTrendArrowUp[i]->SetVisible(true);
+			m_imageTrendArrowDown[i]->SetVisible(false);
+			m_txtProdPrice[i]->SetTextColor(sf::Color::Green);
+		}
+		else
+		{
+			// Price is falling: show red text with down arrow
+			m_imageTrendArrowUp[i]->SetVisible(false);
+			m_imageTrendArrowDown[i]->SetVisible(true);
+			m_txtProdPrice[i]->SetTextColor(sf::Color::Red);
+		}
+	}
+}
 
-			// Update visual trend indicators based on price movement direction
-			if (m_imageTrendArrowUp[i] && m_imageTrendArrowDown[i])
-			{
-				if (product->m_trendIncreased)
-				{
-					// Price is rising: show green text with up arrow
-					m_imageTrendArrowUp[i]->SetVisible(true);
-					m_imageTrendArrowDown[i]->SetVisible(false);
-					m_txtProdPrice[i]->SetTextColor(sf::Color::Green);
-				}
-				else
-				{
-					// Price is falling: show red text with down arrow
-					m_imageTrendArrowUp[i]->SetVisible(false);
-					m_imageTrendArrowDown[i]->SetVisible(true);
-					m_txtProdPrice[i]->SetTextColor(sf::Color::Red);
-				}
-			}
+/// @brief Refresh the widgets bound to model values that changed since the last frame
+/// @param changeBus Bus the stock market and inventory report their changes to
+/// @details Called once per frame; several changes to the same value cost one refresh
+void ApplicationUI::ApplyModelChanges(ModelChangeBus& changeBus)
+{
+	MEMORY_TAG_SCOPE(MemoryTag::UI, "ApplyModelChanges");
+	changeBus.Drain(m_modelChanges);
+	if (m_modelChanges.IsEmpty())
+		return;
+
+	for (int i = 0; i < 5; ++i)
+	{
+		uint32_t fields = m_monitorProductIndices[i] >= 0 ? m_modelChanges.GetProductFields(static_cast<uint32_t>(m_monitorProductIndices[i])) : 0;
+		if (fields != 0)
+		{
+			UpdateProductDisplay(i, fields);
 		}
 	}
+
+	if (m_modelChanges.Has(PlayerField::Money))
+	{
+		UpdateCurrentMoneyDisplay();
+	}
+	if (m_modelChanges.Has(PlayerField::InventoryVolume))
+	{
+		UpdateInventoryVolumeDisplay();
+	}
+	if (m_modelChanges.Has(PlayerField::InventoryContents))
+	{
+		UpdateInventoryVerticalButtons();
+	}
 }
 
 /// @brief Update rolling text animations - moves text continuously from right to left
@@ -1384,6 +1321,7 @@ void ApplicationUI::UpdateProductDisplays()
 ///          - Using different starting positions for staggered effect
 void ApplicationUI::UpdateApplicationUI(sf::Time deltaTime)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::UI, "UpdateApplicationUI");
 
 	// Safety check for rolling text widgets
 	if (!m_rollingText1 || !m_rollingText2)
@@ -1474,6 +1412,46 @@ void ApplicationUI::UpdateCycleProgressBar()
 	// Set the custom countdown text
 	m_cycleProgressBar->SetCustomText(countdownText.str());
 }
+
+/// @brief Get the vendor portrait file for a monitor
+/// @param monitorIndex Monitor index (0-4)
+/// @return Image file name relative to the resources folder
+const char* ApplicationUI::GetVendorImageFile(int monitorIndex)
+{
+	switch (monitorIndex) {
+	case 0: return "CharacterTriton.png";    // TRI
+	case 1: return "CharacterFlux.png";      // NFX
+	case 2: return "CharacterZeromass.png";  // ZER
+	case 3: return "CharacterLuma.png";      // LUM
+	case 4: return "CharacterNano.png";      // NAN
+	default: return "CharacterNano.png";     // Fallback
+	}
+}
+
+/// @brief Get the company logo file for a monitor
+/// @param monitorIndex Monitor index (0-4)
+/// @return Image file name relative to the resources folder
+const char* ApplicationUI::GetCompanyLogoFile(int monitorIndex)
+{
+	switch (monitorIndex) {
+	case 0: return "TritonDynamics.png";     // TRI
+	case 1: return "FluxNeurals.png";        // NFX
+	case 2: return "ZeromassLabs.png";       // ZER
+	case 3: return "Lumacore.png";           // LUM
+	case 4: return "NanodyneIndustries.png"; // NAN
+	default: return "Lumacore.png";          // Fallback
+	}
+}
+
+/// @brief Start decoding the vendor portrait and company logo of a monitor in the background
+/// @param monitorIndex Monitor index (0-4) the cursor is hovering
+/// Called on hover so the images are usually resident by the time the monitor is selected
+void ApplicationUI::PrefetchMonitorImages(int monitorIndex)
+{
+	ui::TextureCache::Get().Prefetch(Application::ResolveTexturePath(GetVendorImageFile(monitorIndex)));
+	ui::TextureCache::Get().Prefetch(Application::ResolveTexturePath(GetCompanyLogoFile(monitorIndex)));
+}
+
 /// @brief Select a monitor button and apply purple highlighting
 /// @brief Select a monitor button and apply purple highlighting
 /// @param monitorIndex Index of the monitor button to select (0-4)
@@ -1584,16 +1562,7 @@ void ApplicationUI::SelectMonitor(int monitorIndex) {
 
 			// Update vendor character image based on selected product ID
 			if (m_vendorImage) {
-				std::string vendorImageFile;
-				switch (monitorIndex) {
-				case 0: vendorImageFile = "CharacterTriton.png"; break;    // TRI
-				case 1: vendorImageFile = "CharacterFlux.png"; break;      // NFX
-				case 2: vendorImageFile = "CharacterZeromass.png"; break;  // ZER
-				case 3: vendorImageFile = "CharacterLuma.png"; break;      // LUM
-				case 4: vendorImageFile = "CharacterNano.png"; break;      // NAN
-				default: vendorImageFile = "CharacterNano.png"; break;     // Fallback
-				}
-				m_vendorImage->LoadImage(vendorImageFile);
+				m_vendorImage->LoadImageLazy(GetVendorImageFile(monitorIndex));
 			}
 
 			// Update vendor product name text with selected product name
@@ -1623,16 +1592,7 @@ void ApplicationUI::SelectMonitor(int monitorIndex) {
 
 			// Update company logo based on selected product ID
 			if (m_companyLogo) {
-				std::string companyLogoFile;
-				switch (monitorIndex) {
-					case 0: companyLogoFile = "TritonDynamics.png"; break;     // TRI
-					case 1: companyLogoFile = "FluxNeurals.png"; break;        // NFX
-					case 2: companyLogoFile = "ZeromassLabs.png"; break;       // ZER
-					case 3: companyLogoFile = "Lumacore.png"; break;           // LUM
-					case 4: companyLogoFile = "NanodyneIndustries.png"; break; // NAN
-					default: companyLogoFile = "Lumacore.png"; break;          // Fallback
-				}
-				m_companyLogo->LoadImage(companyLogoFile);
+				m_companyLogo->LoadImageLazy(GetCompanyLogoFile(monitorIndex));
 			}
 
 			// Update role text with vendor role from vendor data
@@ -1797,6 +1757,8 @@ void ApplicationUI::SelectInventorySort(InventorySortType sortType) {
 			m_quantitySortButton->LoadImage("BgInventory.png");
 		}
 		break;
+	default:
+		break;
 	}
 
 	// Update inventory buttons to reflect the new sort order
@@ -1852,172 +1814,166 @@ void ApplicationUI::UpdateCurrentMoneyDisplay()
 	m_currentMoneyText->SetText(moneyText);
 }
 
-/// @brief Update inventory vertical buttons with current player inventory data
-/// @details Sorts player inventory by quantity (descending) and updates the 5 inventory buttons
-///          with product images, quantity and volume information. Only shows items with quantity > 0.
+/// @brief Update inventory volume progress bar and its "current/max" text
+/// @details Shows the used volume ratio of the player inventory
+void ApplicationUI::UpdateInventoryVolumeDisplay()
+{
+	// Safety check: ensure we have valid application, inventory, and volume progress bar
+	if (!m_application || !m_application->GetPlayerInventory() || !m_volumeProgressBar)
+		return;
+
+	float currentVolume = m_application->GetPlayerInventory()->GetCurrentInventoryVolume();
+	float maxVolume = m_application->GetPlayerInventory()->GetMaxInventoryVolume();
+
+	// Calculate progress ratio (0.0 to 1.0)
+	float progressRatio = (maxVolume > 0.0f) ? (currentVolume / maxVolume) : 0.0f;
+
+	// Ensure ratio stays within bounds
+	progressRatio = std::max(0.0f, std::min(1.0f, progressRatio));
+
+	// Set the progress bar value
+	m_volumeProgressBar->SetProgress(progressRatio);
+
+	// Create the display text in format "current/max"
+	std::ostringstream volumeText;
+	volumeText << std::fixed << std::setprecision(0) << currentVolume << "/" << maxVolume << " VOL";
+
+	// Set the custom text (this will override the default percentage display)
+	m_volumeProgressBar->SetCustomText(volumeText.str());
+}
+
+/// @brief Update the inventory list with current player inventory data
+/// @details The inventory keeps its held products sorted for every sort type; the list only
+///          needs the new item count and rebinds its visible rows
 void ApplicationUI::UpdateInventoryVerticalButtons()
 {
-	// Safety check: ensure we have valid application and inventory
-	if (!m_application || !m_application->GetPlayerInventory())
+	PROFILE_SCOPE("UpdateInventoryVerticalButtons");
+	MEMORY_TAG_SCOPE(MemoryTag::UI, "UpdateInventoryVerticalButtons");
+	// Safety check: ensure we have valid application, inventory and list
+	if (!m_application || !m_application->GetPlayerInventory() || !m_inventoryList)
 		return;
 
-	// Get player inventory products
-	const std::vector<StockProduct>& playerProducts = m_application->GetPlayerInventory()->GetPlayerProducts();
+	m_inventoryList->SetItemCount(m_application->GetPlayerInventory()->GetSortedProductIndices(m_selectedSortType).size());
+}
 
-	// Create a copy for sorting (filter out items with 0 quantity)
-	std::vector<StockProduct> sortedProducts;
-	for (const auto& product : playerProducts)
-	{
-		if (product.m_quantity > 0)
-		{
-			sortedProducts.push_back(product);
-		}
-	}
+/// @brief Scroll the inventory list and advance its smooth scrolling
+/// @param delta Unscaled frame time (scrolling keeps working while the game is paused)
+/// @param scrollAxis Analog scroll input in range -1..1 (gamepad stick), 0 for none
+void ApplicationUI::UpdateInventoryList(sf::Time delta, float scrollAxis)
+{
+	MEMORY_TAG_SCOPE(MemoryTag::UI, "UpdateInventoryList");
+	if (!m_inventoryList)
+		return;
 
-	// Sort based on selected sort type
-	if (m_selectedSortType == InventorySortType::Quantity)
-	{
-		// Sort by quantity in descending order (highest quantity first)
-		std::sort(sortedProducts.begin(), sortedProducts.end(),
-			[](const StockProduct& a, const StockProduct& b) {
-				return a.m_quantity > b.m_quantity;
-			});
-	}
-	else if (m_selectedSortType == InventorySortType::Volume)
-	{
-		// Sort by total volume in descending order (highest volume first)
-		std::sort(sortedProducts.begin(), sortedProducts.end(),
-			[](const StockProduct& a, const StockProduct& b) {
-				float volumeA = a.m_quantity * a.m_volume;
-				float volumeB = b.m_quantity * b.m_volume;
-				return volumeA > volumeB;
-			});
-	}
-
-	// Array of button containers, buttons, images and texts for easy access
-	ui::WidgetContainer* containers[5] = {
-		m_inventoryButton1Container, m_inventoryButton2Container, m_inventoryButton3Container,
-		m_inventoryButton4Container, m_inventoryButton5Container
-	};
-	ui::WidgetImage* productImages[5] = {
-		m_inventoryButton1ProductImage, m_inventoryButton2ProductImage, m_inventoryButton3ProductImage,
-		m_inventoryButton4ProductImage, m_inventoryButton5ProductImage
-	};
-	ui::WidgetText* volumeTexts[5] = {
-		m_inventoryButton1VolumeText, m_inventoryButton2VolumeText, m_inventoryButton3VolumeText,
-		m_inventoryButton4VolumeText, m_inventoryButton5VolumeText
-	};
-	ui::WidgetText* quantityTexts[5] = {
-		m_inventoryButton1QuantityText, m_inventoryButton2QuantityText, m_inventoryButton3QuantityText,
-		m_inventoryButton4QuantityText, m_inventoryButton5QuantityText
-	};
+	m_inventoryList->SetScrollVelocity(scrollAxis * s_inventoryScrollSpeed);
+	m_inventoryList->Update(delta);
+}
 
-	// Hide all containers first
-	for (int i = 0; i < 5; i++)
-	{
-		if (containers[i])
-		{
-			containers[i]->SetVisible(false);
-		}
-	}
+/// @brief Create the widgets of one inventory list row
+/// @param slot Row pool slot of the inventory list
+/// @return Row container with background button, product image, volume and quantity texts
+ui::WidgetPtr ApplicationUI::CreateInventoryRow(size_t slot)
+{
+	auto rowContainer = std::make_unique<ui::WidgetContainer>(0, 0, 530, 45);
+	rowContainer->SetLayout(ui::LayoutType::Native); // Manual positioning for precise control
+
+	// Row background button selects the monitor of the product currently bound to this slot
+	auto rowButton = std::make_unique<ui::WidgetButton>(0, 0, 530, 45);
+	rowButton->LoadImage("BgInventory.png");
+	rowButton->SetOnClickCallback([this, slot]() {
+		SelectInventoryItemMonitor(m_inventoryList->GetSlotItem(slot));
+	});
+	rowContainer->AddWidget(std::move(rowButton));
 
-	// Update visible buttons with sorted product data
-	for (int i = 0; i < std::min(5, (int)sortedProducts.size()); i++)
-	{
-		const StockProduct& product = sortedProducts[i];
+	InventoryRow row;
 
-		// Show container
-		if (containers[i])
-		{
-			containers[i]->SetVisible(true);
-		}
+	// Product image (bound per item)
+	auto productImage = std::make_unique<ui::WidgetImage>(20, 7, 30, 30);
+	row.m_productImage = productImage.get();
+	rowContainer->AddWidget(std::move(productImage));
 
-		// Update product image based on product ID
-		if (productImages[i])
-		{
-			std::string imageFile = "IconMaterialNano.png"; // Default fallback
-			if (product.m_id == "TRI") imageFile = "IconMaterialTritanium.png";
-			else if (product.m_id == "NFX") imageFile = "IconMaterialNeuro.png";
-			else if (product.m_id == "ZER") imageFile = "IconMaterialZeromass.png";
-			else if (product.m_id == "LUM") imageFile = "IconMaterialLumi.png";
-			else if (product.m_id == "NAN") imageFile = "IconMaterialNano.png";
-
-			productImages[i]->LoadImage(imageFile);
-		}
+	// Volume text
+	auto volumeText = std::make_unique<ui::WidgetText>(200, 12, "NA");
+	volumeText->SetCharacterSize(14);
+	volumeText->SetTextColor(sf::Color::Cyan);
+	volumeText->SetStyle(sf::Text::Bold);
+	row.m_volumeText = volumeText.get();
+	rowContainer->AddWidget(std::move(volumeText));
+
+	// Quantity text
+	auto quantityText = std::make_unique<ui::WidgetText>(450, 12, "NA");
+	quantityText->SetCharacterSize(14);
+	quantityText->SetTextColor(sf::Color::Yellow);
+	quantityText->SetStyle(sf::Text::Bold);
+	row.m_quantityText = quantityText.get();
+	rowContainer->AddWidget(std::move(quantityText));
+
+	m_inventoryRows.push_back(row);
+	return rowContainer;
+}
 
-		// Update quantity text
-		if (quantityTexts[i])
-		{
-			quantityTexts[i]->SetText("Qty: " + std::to_string(product.m_quantity));
-		}
+/// @brief Show an inventory item in a row of the inventory list
+/// @param slot Row pool slot to fill
+/// @param itemIndex Position of the item in the selected sort order
+void ApplicationUI::BindInventoryRow(size_t slot, size_t itemIndex)
+{
+	if (!m_application || !m_application->GetPlayerInventory() || slot >= m_inventoryRows.size())
+		return;
 
-		// Update volume text
-		if (volumeTexts[i])
-		{
-			float totalVolume = product.m_quantity * product.m_volume;
-			std::ostringstream volumeStream;
-			volumeStream << "Vol: " << std::fixed << std::setprecision(1) << totalVolume;
-			volumeTexts[i]->SetText(volumeStream.str());
-		}
-	}
+	const StockProduct* product = m_application->GetPlayerInventory()->GetSortedProduct(m_selectedSortType, itemIndex);
+	if (!product)
+		return;
+
+	const InventoryRow& row = m_inventoryRows[slot];
+
+	// Product image is shared through the texture cache, so recycling rows does not reload files
+	row.m_productImage->LoadImageLazy(GetProductIconFile(product->m_id));
+
+	// Update quantity text
+	row.m_quantityText->SetText("Qty: " + std::to_string(product->m_quantity));
+
+	// Update volume text
+	float totalVolume = product->m_quantity * product->m_volume;
+	std::ostringstream volumeStream;
+	volumeStream << "Vol: " << std::fixed << std::setprecision(1) << totalVolume;
+	row.m_volumeText->SetText(volumeStream.str());
+}
+
+/// @brief Get the inventory icon file of a product
+/// @param productId Product ID (TRI, NFX, ZER, LUM, NAN)
+/// @return Image file name, the Nanochip icon for unknown products
+const char* ApplicationUI::GetProductIconFile(const std::string& productId)
+{
+	if (productId == "TRI") return "IconMaterialTritanium.png";
+	if (productId == "NFX") return "IconMaterialNeuro.png";
+	if (productId == "ZER") return "IconMaterialZeromass.png";
+	if (productId == "LUM") return "IconMaterialLumi.png";
+	return "IconMaterialNano.png"; // Default fallback
 }
 
 /// @brief Select monitor based on inventory item at given index
-/// @param inventoryIndex Index of the inventory item (0-4)
+/// @param inventoryIndex Position of the item in the sorted inventory list
 /// @details Finds the product ID of the item at the given inventory index
 ///          and selects the corresponding monitor that displays that product
-void ApplicationUI::SelectInventoryItemMonitor(int inventoryIndex)
+void ApplicationUI::SelectInventoryItemMonitor(size_t inventoryIndex)
 {
 	// Safety checks
-	if (!m_application || !m_application->GetPlayerInventory() || inventoryIndex < 0 || inventoryIndex >= 5)
+	if (!m_application || !m_application->GetPlayerInventory())
 		return;
 
-	// Get player inventory products
-	const std::vector<StockProduct>& playerProducts = m_application->GetPlayerInventory()->GetPlayerProducts();
-
-	// Create a sorted copy matching the current inventory display order
-	std::vector<StockProduct> sortedProducts;
-	for (const auto& product : playerProducts)
-	{
-		if (product.m_quantity > 0)
-		{
-			sortedProducts.push_back(product);
-		}
-	}
-
-	// Sort based on current sort type (same logic as UpdateInventoryVerticalButtons)
-	if (m_selectedSortType == InventorySortType::Quantity)
-	{
-		std::sort(sortedProducts.begin(), sortedProducts.end(),
-			[](const StockProduct& a, const StockProduct& b) {
-				return a.m_quantity > b.m_quantity;
-			});
-	}
-	else if (m_selectedSortType == InventorySortType::Volume)
-	{
-		std::sort(sortedProducts.begin(), sortedProducts.end(),
-			[](const StockProduct& a, const StockProduct& b) {
-				float volumeA = a.m_quantity * a.m_volume;
-				float volumeB = b.m_quantity * b.m_volume;
-				return volumeA > volumeB;
-			});
-	}
-
-	// Check if we have a product at the requested index
-	if (inventoryIndex >= (int)sortedProducts.size())
+	// The list shows the inventory's sorted view for the current sort type
+	const StockProduct* product = m_application->GetPlayerInventory()->GetSortedProduct(m_selectedSortType, inventoryIndex);
+	if (!product)
 		return;
 
 	// Get the product ID at this inventory index
-	std::string productId = sortedProducts[inventoryIndex].m_id;
-
-	// Map product IDs to monitor indices (same mapping as in SelectMonitor)
-	std::string productIds[5] = { "TRI", "NFX", "ZER", "LUM", "NAN" };
+	const std::string& productId = product->m_id;
 
-	// Find the monitor index that corresponds to this product
+	// Find the monitor index that corresponds to this product (same mapping as in SelectMonitor)
 	int monitorIndex = -1;
 	for (int i = 0; i < 5; i++)
 	{
-		if (productIds[i] == productId)
+		if (productId == s_monitorProductIds[i])
 		{
 			monitorIndex = i;
 			break;
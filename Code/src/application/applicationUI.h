@@ -4,24 +4,14 @@
 #include "../framework/WidgetButton.h"
 #include "../framework/WidgetContainer.h"
 #include "../framework/WidgetProgressBar.h"
+#include "../framework/WidgetListView.h"
+#include "modelChangeBus.h"
+#include "inventory.h"
 #include <SFML/Graphics.hpp>
 #include "pch.h"
 
 class Application; // Forward declaration
 
-//==============================================================================
-// Enums for UI functionality
-//==============================================================================
-
-/// @brief Inventory sort types for sorting inventory items
-enum class InventorySortType
-{
-  Volume,   // Sort by total volume (quantity * volume per item)
-  Quantity  // Sort by quantity
-};
-
-
-
 //==============================================================================
 // ApplicationUI Class - Handles all UI initialization and management
 //==============================================================================
@@ -55,10 +45,14 @@ public:
   void LoadingNewText(bool first);
 
   // Update functions
+  void ApplyModelChanges(ModelChangeBus& changeBus);
   void UpdateProductDisplays();
+  void UpdateProductDisplay(int monitorIndex, uint32_t fields);
+  void UpdateInventoryVolumeDisplay();
   void UpdateCycleProgressBar();
   void UpdateCurrentMoneyDisplay();
   void UpdateInventoryVerticalButtons();
+  void UpdateInventoryList(sf::Time delta, float scrollAxis);
   void UpdateTradeDisplay();
 
   void UpdateApplicationUI( sf::Time delta);
@@ -66,7 +60,8 @@ public:
   // Monitor selection functions
   void SelectMonitor(int monitorIndex);
   void CancelSelection();
-  void SelectInventoryItemMonitor(int inventoryIndex);
+  void SelectInventoryItemMonitor(size_t inventoryIndex);
+  void PrefetchMonitorImages(int monitorIndex);
 
   // Info panel selection functions
   void SelectInfoPanel(int panelIndex);
@@ -128,9 +123,26 @@ public:
   ui::WidgetText* GetProductNameText() const { return m_productNameText; }
 
 private:
+  // Vendor portrait and company logo file names per monitor
+  static const char* GetVendorImageFile(int monitorIndex);
+  static const char* GetCompanyLogoFile(int monitorIndex);
+  static const char* GetProductIconFile(const std::string& productId);
+
+  // Inventory list rows
+  ui::WidgetPtr CreateInventoryRow(size_t slot);
+  void BindInventoryRow(size_t slot, size_t itemIndex);
+
   // Application reference
   Application* m_application = nullptr;
 
+  // Model changes drained each frame (kept to reuse its storage)
+  ModelChanges m_modelChanges;
+
+  // Product IDs shown on the 5 monitors (TRI=Tritanium, NFX=Neuroflux, ZER=Zeromass, LUM=Lumirite, NAN=Nanochip)
+  static const char* const s_monitorProductIds[5];
+  // Their indices in the stock market (keys of ModelChanges), resolved by UpdateProductDisplays; -1 if missing
+  int32_t m_monitorProductIndices[5] = { -1, -1, -1, -1, -1 };
+
   // UI variables
   std::unique_ptr<ui::WidgetContainer> m_rootContainer; // Root container for all widgets
   ui::WidgetContainer* m_monitorMenuContainer; // Pointer to monitor menu container (owned by root container)
@@ -206,34 +218,17 @@ private:
   // Inventory container widgets
   ui::WidgetText* m_volumeText;              // Volume text in inventory container
   ui::WidgetProgressBar* m_volumeProgressBar; // Volume progress bar in inventory container
-  ui::WidgetContainer* m_inventoryProductsContainer; // Vertical container for inventory products
-
-  // Inventory button containers (1-5)
-  ui::WidgetContainer* m_inventoryButton1Container;  // Container for inventory button 1
-  ui::WidgetContainer* m_inventoryButton2Container;  // Container for inventory button 2
-  ui::WidgetContainer* m_inventoryButton3Container;  // Container for inventory button 3
-  ui::WidgetContainer* m_inventoryButton4Container;  // Container for inventory button 4
-  ui::WidgetContainer* m_inventoryButton5Container;  // Container for inventory button 5
-  ui::WidgetButton* m_inventoryButton1;              // Inventory button 1
-  ui::WidgetButton* m_inventoryButton2;              // Inventory button 2
-  ui::WidgetButton* m_inventoryButton3;              // Inventory button 3
-  ui::WidgetButton* m_inventoryButton4;              // Inventory button 4
-  ui::WidgetButton* m_inventoryButton5;              // Inventory button 5
-  ui::WidgetImage* m_inventoryButton1ProductImage;   // Product image for button 1
-  ui::WidgetImage* m_inventoryButton2ProductImage;   // Product image for button 2
-  ui::WidgetImage* m_inventoryButton3ProductImage;   // Product image for button 3
-  ui::WidgetImage* m_inventoryButton4ProductImage;   // Product image for button 4
-  ui::WidgetImage* m_inventoryButton5ProductImage;   // Product image for button 5
-  ui::WidgetText* m_inventoryButton1VolumeText;      // Volume text for button 1
-  ui::WidgetText* m_inventoryButton2VolumeText;      // Volume text for button 2
-  ui::WidgetText* m_inventoryButton3VolumeText;      // Volume text for button 3
-  ui::WidgetText* m_inventoryButton4VolumeText;      // Volume text for button 4
-  ui::WidgetText* m_inventoryButton5VolumeText;      // Volume text for button 5
-  ui::WidgetText* m_inventoryButton1QuantityText;    // Quantity text for button 1
-  ui::WidgetText* m_inventoryButton2QuantityText;    // Quantity text for button 2
-  ui::WidgetText* m_inventoryButton3QuantityText;    // Quantity text for button 3
-  ui::WidgetText* m_inventoryButton4QuantityText;    // Quantity text for button 4
-  ui::WidgetText* m_inventoryButton5QuantityText;    // Quantity text for button 5
+  ui::WidgetListView* m_inventoryList;       // Scrolling list of the held products
+
+  // Widgets of one inventory list row, indexed by row pool slot
+  struct InventoryRow
+  {
+    ui::WidgetImage* m_productImage;
+    ui::WidgetText* m_volumeText;
+    ui::WidgetText* m_quantityText;
+  };
+  std::vector<InventoryRow> m_inventoryRows;
+  static constexpr float s_inventoryScrollSpeed = 1200.0f; // Pixels per second at full stick deflection
 
   // Inventory sort selector widgets
   ui::WidgetContainer* m_inventorySortSelectorContainer; // Container for inventory sort selector buttons
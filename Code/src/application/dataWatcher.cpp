@@ -0,0 +1,181 @@
+#include "pch.h"
+#include "dataWatcher.h"
+#include "utilTools.h"
+#include <algorithm>
+#include <chrono>
+#include <sys/stat.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+DataWatcher::DataWatcher()
+	: m_running(false)
+{
+}
+
+/// @brief Destructor - stops the watcher thread before members are released
+DataWatcher::~DataWatcher()
+{
+	Stop();
+}
+
+/// @brief Starts watching files on a background thread
+/// @param directory Directory containing the files (with trailing separator)
+/// @param fileNames Names of the files to watch inside the directory
+/// @param callback Called on the watcher thread with the name of a changed file
+/// @return true if the watcher thread was started
+bool DataWatcher::Start(const std::string& directory, const std::vector<std::string>& fileNames, ChangeCallback callback)
+{
+	if (m_running)
+	{
+		return false;
+	}
+
+	m_directory = directory;
+	m_fileNames = fileNames;
+	m_callback = std::move(callback);
+	m_running = true;
+	m_thread = std::thread(&DataWatcher::WatchLoop, this);
+
+	DebugLog("DataWatcher - Watching " + std::to_string(m_fileNames.size()) + " files in " + m_directory);
+	return true;
+}
+
+/// @brief Stops the watcher thread and waits for it to exit
+void DataWatcher::Stop()
+{
+	m_running = false;
+	if (m_thread.joinable())
+	{
+		m_thread.join();
+	}
+}
+
+/// @brief Checks whether the watcher thread is running
+/// @return true while files are being watched
+bool DataWatcher::IsRunning() const
+{
+	return m_running;
+}
+
+/// @brief Checks whether a file name belongs to the watched set
+/// @param fileName File name without directory
+/// @return true if the file is watched
+bool DataWatcher::IsWatchedFile(const std::string& fileName) const
+{
+	return std::find(m_fileNames.begin(), m_fileNames.end(), fileName) != m_fileNames.end();
+}
+
+/// @brief Watcher thread body
+/// Collects change notifications and reports each file once it has been quiet
+/// for s_settleDelayMs, so a save written in several chunks is parsed only once
+void DataWatcher::WatchLoop()
+{
+	TRACE_THREAD_NAME("DataWatcher");
+	using Clock = std::chrono::steady_clock;
+	std::vector<std::pair<std::string, Clock::time_point>> pending;
+
+	auto markChanged = [&pending](const std::string& fileName)
+	{
+		for (auto& entry : pending)
+		{
+			if (entry.first == fileName)
+			{
+				entry.second = Clock::now();
+				return;
+			}
+		}
+		pending.emplace_back(fileName, Clock::now());
+	};
+
+	auto reportSettled = [this, &pending]()
+	{
+		const Clock::time_point now = Clock::now();
+		for (auto it = pending.begin(); it != pending.end();)
+		{
+			if (now - it->second >= std::chrono::milliseconds(s_settleDelayMs))
+			{
+				m_callback(it->first);
+				it = pending.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	};
+
+#ifdef __linux__
+	// Watch the directory rather than the files: editors often save by writing a
+	// temporary file and renaming it over the original, which replaces the inode
+	int descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (descriptor < 0 || inotify_add_watch(descriptor, m_directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+	{
+		if (descriptor >= 0)
+		{
+			close(descriptor);
+		}
+		m_running = false;
+		return;
+	}
+
+	alignas(inotify_event) char buffer[4096];
+	while (m_running)
+	{
+		pollfd request = { descriptor, POLLIN, 0 };
+		if (poll(&request, 1, s_pollIntervalMs) > 0)
+		{
+			ssize_t length;
+			while ((length = read(descriptor, buffer, sizeof(buffer))) > 0)
+			{
+				for (char* cursor = buffer; cursor < buffer + length;)
+				{
+					const inotify_event* event = reinterpret_cast<const inotify_event*>(cursor);
+					if (event->len > 0 && IsWatchedFile(event->name))
+					{
+						markChanged(event->name);
+					}
+					cursor += sizeof(inotify_event) + event->len;
+				}
+			}
+		}
+		reportSettled();
+	}
+	close(descriptor);
+#else
+	// Poll modification time and size of every watched file
+	std::vector<std::pair<time_t, long long>> stamps(m_fileNames.size(), std::make_pair(time_t(0), -1LL));
+	for (size_t i = 0; i < m_fileNames.size(); ++i)
+	{
+		struct stat info;
+		if (stat((m_directory + m_fileNames[i]).c_str(), &info) == 0)
+		{
+			stamps[i] = std::make_pair(info.st_mtime, static_cast<long long>(info.st_size));
+		}
+	}
+
+	while (m_running)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(s_pollIntervalMs));
+
+		for (size_t i = 0; i < m_fileNames.size(); ++i)
+		{
+			struct stat info;
+			if (stat((m_directory + m_fileNames[i]).c_str(), &info) != 0)
+			{
+				continue; // File is being replaced, check again on the next poll
+			}
+
+			std::pair<time_t, long long> stamp(info.st_mtime, static_cast<long long>(info.st_size));
+			if (stamp != stamps[i])
+			{
+				stamps[i] = stamp;
+				markChanged(m_fileNames[i]);
+			}
+		}
+		reportSettled();
+	}
+#endif
+}
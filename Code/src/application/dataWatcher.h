@@ -0,0 +1,34 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include <functional>
+#include <thread>
+
+/// Watches a set of files in one directory on a background thread and reports
+/// when one of them has been rewritten. Uses inotify on Linux and modification
+/// time polling on other platforms. The callback runs on the watcher thread.
+class DataWatcher final
+{
+public:
+	using ChangeCallback = std::function<void(const std::string& fileName)>;
+
+	DataWatcher();
+	~DataWatcher();
+
+	bool Start(const std::string& directory, const std::vector<std::string>& fileNames, ChangeCallback callback);
+	void Stop();
+	bool IsRunning() const;
+
+private:
+	void WatchLoop();
+	bool IsWatchedFile(const std::string& fileName) const;
+
+	std::string m_directory;                 ///< Directory containing the watched files
+	std::vector<std::string> m_fileNames;    ///< File names (without directory) to report
+	ChangeCallback m_callback;               ///< Invoked once per settled change
+	std::thread m_thread;                    ///< Background watcher thread
+	std::atomic<bool> m_running;             ///< Cleared to stop the watcher thread
+
+	static constexpr int s_pollIntervalMs = 250;  ///< Wake-up interval of the watcher thread
+	static constexpr int s_settleDelayMs = 150;   ///< Quiet time before a change is reported (editors write in bursts)
+};
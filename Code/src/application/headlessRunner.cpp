@@ -0,0 +1,554 @@
+#include "pch.h"
+#include "headlessRunner.h"
+#include "utilTools.h"
+#include "rapidjson/ostreamwrapper.h"
+#include "rapidjson/prettywriter.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+namespace
+{
+	struct KeyName
+	{
+		const char* m_name;
+		sf::Keyboard::Key m_key;
+	};
+
+	// Keys the application reacts to; letters, digits and F keys are derived from their names
+	const KeyName s_keyNames[] = {
+		{ "Space", sf::Keyboard::Space },
+		{ "Escape", sf::Keyboard::Escape },
+		{ "Enter", sf::Keyboard::Enter },
+		{ "Tab", sf::Keyboard::Tab },
+		{ "Add", sf::Keyboard::Add },
+		{ "Subtract", sf::Keyboard::Subtract },
+		{ "Up", sf::Keyboard::Up },
+		{ "Down", sf::Keyboard::Down },
+		{ "Left", sf::Keyboard::Left },
+		{ "Right", sf::Keyboard::Right },
+		{ "PageUp", sf::Keyboard::PageUp },
+		{ "PageDown", sf::Keyboard::PageDown },
+	};
+
+	/// @brief Creates a directory if it does not exist yet
+	/// @return True if the directory exists afterwards
+	bool CreateDirectoryIfMissing(const std::string& path)
+	{
+		struct stat info;
+		if (stat(path.c_str(), &info) == 0)
+		{
+			return (info.st_mode & S_IFDIR) != 0;
+		}
+#ifdef _WIN32
+		return _mkdir(path.c_str()) == 0;
+#else
+		return mkdir(path.c_str(), 0755) == 0;
+#endif
+	}
+
+	/// @brief Value at a fraction of a sorted list (0.5 = median)
+	double Percentile(const std::vector<double>& sorted, double fraction)
+	{
+		if (sorted.empty())
+		{
+			return 0.0;
+		}
+		size_t index = std::min(sorted.size() - 1, static_cast<size_t>(fraction * static_cast<double>(sorted.size())));
+		return sorted[index];
+	}
+
+	template <typename Writer>
+	void WriteNumber(Writer& writer, double value)
+	{
+		writer.Double(value);
+	}
+
+	template <typename Writer>
+	void WriteNumber(Writer& writer, uint32_t value)
+	{
+		writer.Uint(value);
+	}
+
+	bool GetUint(const Json::Value& object, const char* name, uint32_t& value)
+	{
+		if (!object.HasMember(name) || !object[name].IsUint())
+		{
+			return false;
+		}
+		value = object[name].GetUint();
+		return true;
+	}
+
+	bool GetInt(const Json::Value& object, const char* name, int& value)
+	{
+		if (!object.HasMember(name) || !object[name].IsInt())
+		{
+			return false;
+		}
+		value = object[name].GetInt();
+		return true;
+	}
+}
+
+/// @brief Create a runner; nothing is loaded until LoadScript
+/// @param settings Options from the command line
+HeadlessRunner::HeadlessRunner(const HeadlessSettings& settings)
+	: m_settings(settings)
+	, m_nextEvent(0)
+	, m_nextCycles(0)
+	, m_nextGolden(0)
+{
+}
+
+/// @brief Read the input script, if one was given
+/// @return false if the script could not be read or has an invalid step
+/// @details "frames", "frameSeconds" and "seed" in the script override the command line values
+bool HeadlessRunner::LoadScript()
+{
+	if (m_settings.m_scriptPath.empty())
+	{
+		return true;
+	}
+
+	std::ifstream stream(m_settings.m_scriptPath);
+	if (!stream.is_open())
+	{
+		DebugLog("Headless - Could not open input script: " + m_settings.m_scriptPath, DebugType::Error);
+		return false;
+	}
+	std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+	Json::Document document;
+	document.Parse(fileData.c_str());
+	if (document.HasParseError() || !document.IsObject())
+	{
+		DebugLog("Headless - Invalid input script " + m_settings.m_scriptPath + ": " +
+			std::string(Json::GetParseError_En(document.GetParseError())), DebugType::Error);
+		return false;
+	}
+
+	GetUint(document, "frames", m_settings.m_frames);
+	GetUint(document, "seed", m_settings.m_seed);
+	if (document.HasMember("frameSeconds") && document["frameSeconds"].IsNumber())
+	{
+		m_settings.m_frameSeconds = static_cast<float>(document["frameSeconds"].GetDouble());
+	}
+
+	if (document.HasMember("steps"))
+	{
+		const Json::Value& steps = document["steps"];
+		if (!steps.IsArray())
+		{
+			DebugLog("Headless - 'steps' is not an array", DebugType::Error);
+			return false;
+		}
+		for (Json::SizeType i = 0; i < steps.Size(); i++)
+		{
+			if (!ParseStep(steps[i], i))
+			{
+				return false;
+			}
+		}
+	}
+
+	// Steps are consumed frame by frame; keep the script order of steps within a frame
+	auto byFrame = [](const auto& a, const auto& b) { return a.m_frame < b.m_frame; };
+	std::stable_sort(m_events.begin(), m_events.end(), byFrame);
+	std::stable_sort(m_cycles.begin(), m_cycles.end(), byFrame);
+	std::stable_sort(m_goldens.begin(), m_goldens.end(), byFrame);
+
+	DebugLog("Headless - Script " + m_settings.m_scriptPath + ": " + std::to_string(m_settings.m_frames) + " frames, " +
+		std::to_string(m_events.size()) + " events, " + std::to_string(m_cycles.size()) + " cycle steps, " +
+		std::to_string(m_goldens.size()) + " golden frames");
+	return true;
+}
+
+/// @brief Convert one script step into events or actions
+/// @param step JSON object of the step
+/// @param index Position in the script, for error messages
+/// @return false if the step is invalid
+bool HeadlessRunner::ParseStep(const Json::Value& step, size_t index)
+{
+	std::string where = "Headless - Step " + std::to_string(index);
+	uint32_t frame = 0;
+	if (!step.IsObject() || !GetUint(step, "frame", frame) || !step.HasMember("type") || !step["type"].IsString())
+	{
+		DebugLog(where + " needs a 'frame' and a 'type'", DebugType::Error);
+		return false;
+	}
+
+	std::string type = step["type"].GetString();
+	int x = 0;
+	int y = 0;
+	bool hasPosition = GetInt(step, "x", x) && GetInt(step, "y", y);
+
+	ScriptedEvent scripted;
+	scripted.m_frame = frame;
+	InputEvent& event = scripted.m_event;
+
+	if (type == "mouseMove" && hasPosition)
+	{
+		event.type = InputEvent::MouseMoved;
+		event.mouseMove.x = x;
+		event.mouseMove.y = y;
+		m_events.push_back(scripted);
+	}
+	else if (type == "click" && hasPosition)
+	{
+		// Move, press and release, as the pointer would deliver them
+		event.type = InputEvent::MouseMoved;
+		event.mouseMove.x = x;
+		event.mouseMove.y = y;
+		m_events.push_back(scripted);
+
+		event.type = InputEvent::MouseButtonPressed;
+		event.mouseButton.button = sf::Mouse::Left;
+		event.mouseButton.x = x;
+		event.mouseButton.y = y;
+		m_events.push_back(scripted);
+
+		event.type = InputEvent::MouseButtonReleased;
+		m_events.push_back(scripted);
+	}
+	else if (type == "wheel" && hasPosition)
+	{
+		int delta = 0;
+		GetInt(step, "delta", delta);
+		event.type = InputEvent::MouseWheelScrolled;
+		event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+		event.mouseWheelScroll.delta = static_cast<float>(delta);
+		event.mouseWheelScroll.x = x;
+		event.mouseWheelScroll.y = y;
+		m_events.push_back(scripted);
+	}
+	else if (type == "key")
+	{
+		sf::Keyboard::Key key;
+		if (!step.HasMember("key") || !step["key"].IsString() || !ParseKey(step["key"].GetString(), key))
+		{
+			DebugLog(where + " has an unknown 'key'", DebugType::Error);
+			return false;
+		}
+		event.type = InputEvent::KeyPressed;
+		event.key.code = key;
+		event.key.alt = false;
+		event.key.control = false;
+		event.key.shift = step.HasMember("shift") && step["shift"].IsBool() && step["shift"].GetBool();
+		event.key.system = false;
+		m_events.push_back(scripted);
+
+		event.type = InputEvent::KeyReleased;
+		m_events.push_back(scripted);
+	}
+	else if (type == "cycles")
+	{
+		ScriptedAction action;
+		action.m_frame = frame;
+		action.m_count = 1;
+		GetUint(step, "count", action.m_count);
+		m_cycles.push_back(action);
+	}
+	else if (type == "golden")
+	{
+		ScriptedAction action;
+		action.m_frame = frame;
+		action.m_count = 0;
+		action.m_name = step.HasMember("name") && step["name"].IsString() ? step["name"].GetString() : "";
+		m_goldens.push_back(action);
+	}
+	else
+	{
+		DebugLog(where + " has an unknown type '" + type + "' or misses 'x'/'y'", DebugType::Error);
+		return false;
+	}
+	return true;
+}
+
+/// @brief Look up a key by its sf::Keyboard name ("A", "Num1", "F3", "Space")
+/// @param name Key name
+/// @param key Receives the key
+/// @return false for unknown names
+bool HeadlessRunner::ParseKey(const std::string& name, sf::Keyboard::Key& key)
+{
+	if (name.size() == 1 && name[0] >= 'A' && name[0] <= 'Z')
+	{
+		key = static_cast<sf::Keyboard::Key>(sf::Keyboard::A + (name[0] - 'A'));
+		return true;
+	}
+	if (name.size() == 4 && name.compare(0, 3, "Num") == 0 && name[3] >= '0' && name[3] <= '9')
+	{
+		key = static_cast<sf::Keyboard::Key>(sf::Keyboard::Num0 + (name[3] - '0'));
+		return true;
+	}
+	if (name.size() >= 2 && name.size() <= 3 && name[0] == 'F')
+	{
+		int number = std::atoi(name.c_str() + 1);
+		if (number >= 1 && number <= 15)
+		{
+			key = static_cast<sf::Keyboard::Key>(sf::Keyboard::F1 + (number - 1));
+			return true;
+		}
+	}
+	for (const KeyName& keyName : s_keyNames)
+	{
+		if (name == keyName.m_name)
+		{
+			key = keyName.m_key;
+			return true;
+		}
+	}
+	return false;
+}
+
+/// @brief Push the scripted events of a frame into the input queue
+/// @param frame Frame about to be processed
+/// @param queue Queue InputHandle dispatches from; cleared first
+void HeadlessRunner::QueueFrameInput(uint32_t frame, ui::InputQueue& queue)
+{
+	queue.Clear();
+	for (; m_nextEvent < m_events.size() && m_events[m_nextEvent].m_frame <= frame; ++m_nextEvent)
+	{
+		queue.Push(m_events[m_nextEvent].m_event);
+	}
+}
+
+/// @brief Market cycles the script runs at the start of a frame's update
+/// @param frame Frame about to be processed
+/// @return Number of cycle steps
+uint32_t HeadlessRunner::GetFrameCycles(uint32_t frame)
+{
+	uint32_t cycles = 0;
+	for (; m_nextCycles < m_cycles.size() && m_cycles[m_nextCycles].m_frame <= frame; ++m_nextCycles)
+	{
+		cycles += m_cycles[m_nextCycles].m_count;
+	}
+	return cycles;
+}
+
+/// @brief Check whether a frame is dumped as a golden frame
+/// @param frame Frame that was just drawn
+/// @param name Receives the file name (without folder)
+/// @return true if the frame should be written
+bool HeadlessRunner::GetGoldenFrame(uint32_t frame, std::string& name)
+{
+	if (m_settings.m_goldenDir.empty())
+	{
+		return false;
+	}
+
+	std::ostringstream fileName;
+	fileName << "frame_" << std::setw(5) << std::setfill('0') << frame;
+	bool golden = m_settings.m_goldenEvery > 0 && (frame + 1) % m_settings.m_goldenEvery == 0;
+	for (; m_nextGolden < m_goldens.size() && m_goldens[m_nextGolden].m_frame <= frame; ++m_nextGolden)
+	{
+		if (!m_goldens[m_nextGolden].m_name.empty())
+		{
+			fileName << "_" << m_goldens[m_nextGolden].m_name;
+		}
+		golden = true;
+	}
+	name = fileName.str() + ".png";
+	return golden;
+}
+
+/// @brief Record the measurements of a frame
+void HeadlessRunner::AddSample(const HeadlessFrameSample& sample)
+{
+	m_samples.push_back(sample);
+}
+
+/// @brief Write the current content of the render texture as a PNG into the golden frame folder
+/// @param texture Render texture the frame was drawn into
+/// @param name File name from GetGoldenFrame
+/// @return true if the file was written
+bool HeadlessRunner::SaveGoldenFrame(const sf::RenderTexture& texture, const std::string& name) const
+{
+	if (!CreateDirectoryIfMissing(m_settings.m_goldenDir))
+	{
+		DebugLog("Headless - Could not create golden frame folder " + m_settings.m_goldenDir, DebugType::Error);
+		return false;
+	}
+
+	std::string path = m_settings.m_goldenDir + "/" + name;
+	if (!texture.getTexture().copyToImage().saveToFile(path))
+	{
+		DebugLog("Headless - Could not write golden frame " + path, DebugType::Error);
+		return false;
+	}
+	return true;
+}
+
+/// @brief Print frame time percentiles and average draw statistics to the console
+void HeadlessRunner::PrintSummary() const
+{
+	if (m_samples.empty())
+	{
+		std::cout << "Headless run: no frames" << std::endl;
+		return;
+	}
+
+	std::vector<double> cpuMs;
+	double inputMs = 0.0, updateMs = 0.0, drawMs = 0.0, drawCalls = 0.0, vertices = 0.0;
+	for (const HeadlessFrameSample& sample : m_samples)
+	{
+		cpuMs.push_back(sample.m_cpuMs);
+		inputMs += sample.m_inputMs;
+		updateMs += sample.m_updateMs;
+		drawMs += sample.m_drawMs;
+		drawCalls += sample.m_drawCalls;
+		vertices += sample.m_vertices;
+	}
+	std::sort(cpuMs.begin(), cpuMs.end());
+	double count = static_cast<double>(m_samples.size());
+
+	std::cout << std::fixed << std::setprecision(3)
+		<< "Headless run: " << m_samples.size() << " frames" << std::endl
+		<< "  frame ms     median " << Percentile(cpuMs, 0.5) << "   p95 " << Percentile(cpuMs, 0.95)
+		<< "   p99 " << Percentile(cpuMs, 0.99) << "   max " << cpuMs.back() << std::endl
+		<< "  average ms   input " << inputMs / count << "   update " << updateMs / count << "   draw " << drawMs / count << std::endl
+		<< std::setprecision(1)
+		<< "  per frame    draw calls " << drawCalls / count << "   vertices " << vertices / count << std::endl;
+}
+
+/// @brief Write the per-frame measurements and their summary as JSON
+/// @return true if the report was written
+/// @details Per-frame values are stored as one array per measurement, indexed by frame
+bool HeadlessRunner::WriteReport() const
+{
+	std::ofstream file(m_settings.m_reportPath);
+	if (!file.is_open())
+	{
+		DebugLog("Headless - Could not write report " + m_settings.m_reportPath, DebugType::Error);
+		return false;
+	}
+
+	std::vector<double> cpuMs;
+	for (const HeadlessFrameSample& sample : m_samples)
+	{
+		cpuMs.push_back(sample.m_cpuMs);
+	}
+	std::sort(cpuMs.begin(), cpuMs.end());
+
+	Json::OStreamWrapper stream(file);
+	Json::PrettyWriter<Json::OStreamWrapper> writer(stream);
+	writer.SetFormatOptions(Json::kFormatSingleLineArray);
+	writer.SetMaxDecimalPlaces(4);
+	writer.StartObject();
+	writer.Key("script");
+	writer.String(m_settings.m_scriptPath.c_str());
+	writer.Key("frames");
+	writer.Uint(static_cast<uint32_t>(m_samples.size()));
+	writer.Key("frameSeconds");
+	writer.Double(m_settings.m_frameSeconds);
+	writer.Key("seed");
+	writer.Uint(m_settings.m_seed);
+	writer.Key("medianFrameMs");
+	writer.Double(Percentile(cpuMs, 0.5));
+	writer.Key("p95FrameMs");
+	writer.Double(Percentile(cpuMs, 0.95));
+	writer.Key("p99FrameMs");
+	writer.Double(Percentile(cpuMs, 0.99));
+	writer.Key("maxFrameMs");
+	writer.Double(cpuMs.empty() ? 0.0 : cpuMs.back());
+
+	writer.Key("perFrame");
+	writer.StartObject();
+	auto writeColumn = [&writer, this](const char* name, auto value)
+	{
+		writer.Key(name);
+		writer.StartArray();
+		for (const HeadlessFrameSample& sample : m_samples)
+		{
+			WriteNumber(writer, value(sample));
+		}
+		writer.EndArray();
+	};
+	writeColumn("cpuMs", [](const HeadlessFrameSample& sample) { return sample.m_cpuMs; });
+	writeColumn("inputMs", [](const HeadlessFrameSample& sample) { return sample.m_inputMs; });
+	writeColumn("updateMs", [](const HeadlessFrameSample& sample) { return sample.m_updateMs; });
+	writeColumn("drawMs", [](const HeadlessFrameSample& sample) { return sample.m_drawMs; });
+	writeColumn("drawCalls", [](const HeadlessFrameSample& sample) { return sample.m_drawCalls; });
+	writeColumn("vertices", [](const HeadlessFrameSample& sample) { return sample.m_vertices; });
+	writeColumn("textureChanges", [](const HeadlessFrameSample& sample) { return sample.m_textureChanges; });
+	writer.EndObject();
+	writer.EndObject();
+	file << std::endl;
+
+	if (!file.good())
+	{
+		DebugLog("Headless - Could not write report " + m_settings.m_reportPath, DebugType::Error);
+		return false;
+	}
+	DebugLog("Headless - Report written to " + m_settings.m_reportPath);
+	return true;
+}
+
+/// @brief Compare the draw statistics of the run with the baseline file, or record them into it
+/// @return false if a count rose above the baseline or the file could not be read or written
+/// @details The highest count of any frame is compared, which does not depend on how many
+///          frames the loader thread needed to deliver the textures
+bool HeadlessRunner::CheckDrawBaseline() const
+{
+	if (m_settings.m_drawBaselinePath.empty())
+	{
+		return true;
+	}
+
+	uint32_t maxDrawCalls = 0;
+	uint32_t maxTextureChanges = 0;
+	for (const HeadlessFrameSample& sample : m_samples)
+	{
+		maxDrawCalls = std::max(maxDrawCalls, sample.m_drawCalls);
+		maxTextureChanges = std::max(maxTextureChanges, sample.m_textureChanges);
+	}
+
+	if (m_settings.m_writeDrawBaseline)
+	{
+		std::ofstream file(m_settings.m_drawBaselinePath);
+		file << "{ \"maxDrawCalls\": " << maxDrawCalls << ", \"maxTextureChanges\": " << maxTextureChanges << " }" << std::endl;
+		if (!file.good())
+		{
+			DebugLog("Headless - Could not write draw baseline " + m_settings.m_drawBaselinePath, DebugType::Error);
+			return false;
+		}
+		DebugLog("Headless - Draw baseline written to " + m_settings.m_drawBaselinePath);
+		return true;
+	}
+
+	std::ifstream stream(m_settings.m_drawBaselinePath);
+	std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	Json::Document document;
+	document.Parse(fileData.c_str());
+	uint32_t baselineDrawCalls = 0;
+	uint32_t baselineTextureChanges = 0;
+	if (!stream.is_open() || document.HasParseError() || !document.IsObject() ||
+		!GetUint(document, "maxDrawCalls", baselineDrawCalls) || !GetUint(document, "maxTextureChanges", baselineTextureChanges))
+	{
+		DebugLog("Headless - Could not read draw baseline " + m_settings.m_drawBaselinePath, DebugType::Error);
+		return false;
+	}
+
+	bool withinBaseline = true;
+	auto compare = [&withinBaseline](const char* name, uint32_t measured, uint32_t baseline)
+	{
+		if (measured > baseline)
+		{
+			DebugLog(std::string("Headless - ") + name + " per frame rose from " + std::to_string(baseline) + " to " + std::to_string(measured), DebugType::Error);
+			withinBaseline = false;
+		}
+		else if (measured < baseline)
+		{
+			DebugLog(std::string("Headless - ") + name + " per frame fell from " + std::to_string(baseline) + " to " + std::to_string(measured) +
+				"; update the baseline with --write-draw-baseline");
+		}
+	};
+	compare("Draw calls", maxDrawCalls, baselineDrawCalls);
+	compare("Texture changes", maxTextureChanges, baselineTextureChanges);
+	return withinBaseline;
+}
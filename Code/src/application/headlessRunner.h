@@ -0,0 +1,99 @@
+#pragma once
+#include "pch.h"
+#include "../framework/InputQueue.h"
+
+/// Options of a headless run (--headless[=script.json] and related command line options)
+struct HeadlessSettings
+{
+	std::string m_scriptPath;                          ///< Input script; empty runs m_frames frames without input
+	std::string m_reportPath = "headless_report.json"; ///< Per-frame timings and draw statistics
+	std::string m_goldenDir;                           ///< Golden frames are written here when set
+	uint32_t m_goldenEvery = 0;                        ///< Also dump every Nth frame (0 = only the script's golden steps)
+	uint32_t m_frames = 600;                           ///< Frames to run unless the script sets "frames"
+	float m_frameSeconds = 1.0f / 60.0f;               ///< Simulated time per frame unless the script sets "frameSeconds"
+	uint32_t m_seed = 1;                               ///< Random seed unless the script sets "seed"
+	std::string m_drawBaselinePath;                    ///< Fail the run when draw calls or texture changes per frame exceed this baseline
+	bool m_writeDrawBaseline = false;                  ///< Write the measured counts to m_drawBaselinePath instead of checking them
+};
+
+/// Measurements of one headless frame
+struct HeadlessFrameSample
+{
+	double m_cpuMs = 0.0;        ///< Whole frame
+	double m_inputMs = 0.0;      ///< InputHandle with the scripted events
+	double m_updateMs = 0.0;     ///< Scripted market cycles and ApplicationUpdate
+	double m_drawMs = 0.0;       ///< DisplayHandle (CPU side; the GPU runs asynchronously)
+	uint32_t m_drawCalls = 0;
+	uint32_t m_vertices = 0;
+	uint32_t m_textureChanges = 0;
+};
+
+/// Drives Application without a window for frame time regression tests.
+/// The application renders into an sf::RenderTexture at a fixed simulated frame time and a
+/// fixed random seed, so two runs of the same script draw the same frames. The script feeds
+/// input events, market cycles and golden frame requests per frame:
+///
+///     { "frames": 600, "frameSeconds": 0.016667, "seed": 7,
+///       "steps": [ { "frame": 10, "type": "mouseMove", "x": 960, "y": 540 },
+///                  { "frame": 11, "type": "click", "x": 960, "y": 540 },
+///                  { "frame": 20, "type": "key", "key": "Num1", "shift": true },
+///                  { "frame": 30, "type": "wheel", "x": 300, "y": 700, "delta": -2 },
+///                  { "frame": 40, "type": "cycles", "count": 5 },
+///                  { "frame": 41, "type": "golden", "name": "after_cycles" } ] }
+///
+/// With --draw-baseline=file the run also fails when the most draw calls or texture changes
+/// of any frame exceed the counts in the file, so a UI change that adds draws breaks the
+/// regression run; --write-draw-baseline records the counts of the run into the file:
+///
+///     { "maxDrawCalls": 412, "maxTextureChanges": 57 }
+///
+/// SFML still needs an OpenGL context for the render texture; on build agents without a
+/// display run under a virtual X server (xvfb-run), which renders in software.
+class HeadlessRunner final
+{
+public:
+	explicit HeadlessRunner(const HeadlessSettings& settings);
+
+	bool LoadScript();
+
+	uint32_t GetFrameCount() const { return m_settings.m_frames; }
+	float GetFrameSeconds() const { return m_settings.m_frameSeconds; }
+	uint32_t GetSeed() const { return m_settings.m_seed; }
+
+	// Steps of a frame; frames must be asked for in increasing order
+	void QueueFrameInput(uint32_t frame, ui::InputQueue& queue);
+	uint32_t GetFrameCycles(uint32_t frame);
+	bool GetGoldenFrame(uint32_t frame, std::string& name);
+
+	void AddSample(const HeadlessFrameSample& sample);
+	bool SaveGoldenFrame(const sf::RenderTexture& texture, const std::string& name) const;
+	void PrintSummary() const;
+	bool WriteReport() const;
+	bool CheckDrawBaseline() const;
+
+private:
+	struct ScriptedEvent
+	{
+		uint32_t m_frame;
+		InputEvent m_event;
+	};
+
+	struct ScriptedAction
+	{
+		uint32_t m_frame;
+		uint32_t m_count;       ///< Market cycles
+		std::string m_name;     ///< Golden frame name
+	};
+
+	bool ParseStep(const Json::Value& step, size_t index);
+	static bool ParseKey(const std::string& name, sf::Keyboard::Key& key);
+
+	HeadlessSettings m_settings;
+	std::vector<ScriptedEvent> m_events;       ///< Sorted by frame, script order within a frame
+	std::vector<ScriptedAction> m_cycles;
+	std::vector<ScriptedAction> m_goldens;
+	size_t m_nextEvent;
+	size_t m_nextCycles;
+	size_t m_nextGolden;
+	std::vector<HeadlessFrameSample> m_samples;
+};
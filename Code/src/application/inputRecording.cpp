@@ -0,0 +1,486 @@
+#include "pch.h"
+#include "inputRecording.h"
+#include "utilTools.h"
+#include "rapidjson/ostreamwrapper.h"
+#include "rapidjson/prettywriter.h"
+
+namespace
+{
+	constexpr uint32_t s_fileVersion = 1;
+
+	bool GetUint(const Json::Value& object, const char* name, uint32_t& value)
+	{
+		if (!object.HasMember(name) || !object[name].IsUint())
+		{
+			return false;
+		}
+		value = object[name].GetUint();
+		return true;
+	}
+
+	int GetInt(const Json::Value& object, const char* name)
+	{
+		return object.HasMember(name) && object[name].IsInt() ? object[name].GetInt() : 0;
+	}
+
+	float GetFloat(const Json::Value& object, const char* name)
+	{
+		return object.HasMember(name) && object[name].IsNumber() ? static_cast<float>(object[name].GetDouble()) : 0.0f;
+	}
+
+	bool GetBool(const Json::Value& object, const char* name)
+	{
+		return object.HasMember(name) && object[name].IsBool() && object[name].GetBool();
+	}
+
+	uint64_t GetUint64(const Json::Value& object, const char* name)
+	{
+		return object.HasMember(name) && object[name].IsUint64() ? object[name].GetUint64() : 0;
+	}
+
+	/// @brief Write the members of the event union that belong to its type
+	template <typename Writer>
+	void WriteEventFields(Writer& writer, const InputEvent& event)
+	{
+		auto writeInt = [&writer](const char* name, int value)
+		{
+			writer.Key(name);
+			writer.Int(value);
+		};
+
+		switch (event.type)
+		{
+		case InputEvent::Resized:
+			writeInt("width", static_cast<int>(event.size.width));
+			writeInt("height", static_cast<int>(event.size.height));
+			break;
+		case InputEvent::TextEntered:
+			writeInt("unicode", static_cast<int>(event.text.unicode));
+			break;
+		case InputEvent::KeyPressed:
+		case InputEvent::KeyReleased:
+			writeInt("code", event.key.code);
+			writer.Key("alt");
+			writer.Bool(event.key.alt);
+			writer.Key("control");
+			writer.Bool(event.key.control);
+			writer.Key("shift");
+			writer.Bool(event.key.shift);
+			writer.Key("system");
+			writer.Bool(event.key.system);
+			break;
+		case InputEvent::MouseWheelScrolled:
+			writeInt("wheel", event.mouseWheelScroll.wheel);
+			writer.Key("delta");
+			writer.Double(event.mouseWheelScroll.delta);
+			writeInt("x", event.mouseWheelScroll.x);
+			writeInt("y", event.mouseWheelScroll.y);
+			break;
+		case InputEvent::MouseButtonPressed:
+		case InputEvent::MouseButtonReleased:
+			writeInt("button", event.mouseButton.button);
+			writeInt("x", event.mouseButton.x);
+			writeInt("y", event.mouseButton.y);
+			break;
+		case InputEvent::MouseMoved:
+			writeInt("x", event.mouseMove.x);
+			writeInt("y", event.mouseMove.y);
+			break;
+		case InputEvent::JoystickButtonPressed:
+		case InputEvent::JoystickButtonReleased:
+			writeInt("joystick", static_cast<int>(event.joystickButton.joystickId));
+			writeInt("button", static_cast<int>(event.joystickButton.button));
+			break;
+		case InputEvent::JoystickMoved:
+			writeInt("joystick", static_cast<int>(event.joystickMove.joystickId));
+			writeInt("axis", event.joystickMove.axis);
+			writer.Key("position");
+			writer.Double(event.joystickMove.position);
+			break;
+		case InputEvent::JoystickConnected:
+		case InputEvent::JoystickDisconnected:
+			writeInt("joystick", static_cast<int>(event.joystickConnect.joystickId));
+			break;
+		default:
+			// Closed, focus and mouse enter/leave carry no data; touch and sensors are not used
+			break;
+		}
+	}
+
+	/// @brief Fill the members of the event union that belong to its type
+	void ReadEventFields(const Json::Value& object, InputEvent& event)
+	{
+		switch (event.type)
+		{
+		case InputEvent::Resized:
+			event.size.width = static_cast<unsigned int>(GetInt(object, "width"));
+			event.size.height = static_cast<unsigned int>(GetInt(object, "height"));
+			break;
+		case InputEvent::TextEntered:
+			event.text.unicode = static_cast<sf::Uint32>(GetInt(object, "unicode"));
+			break;
+		case InputEvent::KeyPressed:
+		case InputEvent::KeyReleased:
+			event.key.code = static_cast<sf::Keyboard::Key>(GetInt(object, "code"));
+			event.key.alt = GetBool(object, "alt");
+			event.key.control = GetBool(object, "control");
+			event.key.shift = GetBool(object, "shift");
+			event.key.system = GetBool(object, "system");
+			break;
+		case InputEvent::MouseWheelScrolled:
+			event.mouseWheelScroll.wheel = static_cast<sf::Mouse::Wheel>(GetInt(object, "wheel"));
+			event.mouseWheelScroll.delta = GetFloat(object, "delta");
+			event.mouseWheelScroll.x = GetInt(object, "x");
+			event.mouseWheelScroll.y = GetInt(object, "y");
+			break;
+		case InputEvent::MouseButtonPressed:
+		case InputEvent::MouseButtonReleased:
+			event.mouseButton.button = static_cast<sf::Mouse::Button>(GetInt(object, "button"));
+			event.mouseButton.x = GetInt(object, "x");
+			event.mouseButton.y = GetInt(object, "y");
+			break;
+		case InputEvent::MouseMoved:
+			event.mouseMove.x = GetInt(object, "x");
+			event.mouseMove.y = GetInt(object, "y");
+			break;
+		case InputEvent::JoystickButtonPressed:
+		case InputEvent::JoystickButtonReleased:
+			event.joystickButton.joystickId = static_cast<unsigned int>(GetInt(object, "joystick"));
+			event.joystickButton.button = static_cast<unsigned int>(GetInt(object, "button"));
+			break;
+		case InputEvent::JoystickMoved:
+			event.joystickMove.joystickId = static_cast<unsigned int>(GetInt(object, "joystick"));
+			event.joystickMove.axis = static_cast<sf::Joystick::Axis>(GetInt(object, "axis"));
+			event.joystickMove.position = GetFloat(object, "position");
+			break;
+		case InputEvent::JoystickConnected:
+		case InputEvent::JoystickDisconnected:
+			event.joystickConnect.joystickId = static_cast<unsigned int>(GetInt(object, "joystick"));
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+bool GamepadState::operator==(const GamepadState& other) const
+{
+	return m_connected == other.m_connected && m_hasScrollAxis == other.m_hasScrollAxis && m_buttonA == other.m_buttonA &&
+		m_axisX == other.m_axisX && m_axisY == other.m_axisY && m_axisScroll == other.m_axisScroll;
+}
+
+/// @brief Create an empty recording
+InputRecording::InputRecording()
+	: m_seed(0)
+	, m_startChecksum(0)
+	, m_endChecksum(0)
+	, m_lastMultiplier(0.0f)
+	, m_nextEvent(0)
+	, m_nextGamepad(0)
+	, m_nextMultiplier(0)
+	, m_expectedMultiplier(0.0f)
+{
+}
+
+/// @brief Start a new recording
+/// @param seed Seed the random generator was initialized with, before the market drew its initial values
+/// @param startChecksum State checksum after initialization
+/// @param mousePosition Pointer position when the application started
+void InputRecording::BeginRecording(uint32_t seed, uint64_t startChecksum, const sf::Vector2i& mousePosition)
+{
+	m_seed = seed;
+	m_startChecksum = startChecksum;
+	m_startMousePosition = mousePosition;
+	m_endChecksum = 0;
+	m_frameMicroseconds.clear();
+	m_events.clear();
+	m_gamepadChanges.clear();
+	m_multiplierChanges.clear();
+}
+
+/// @brief Append one frame
+/// @param delta Frame time passed to ApplicationUpdate
+/// @param events Events dispatched by InputHandle this frame
+/// @param gamepad Gamepad state read this frame
+/// @param timeMultiplier Global time multiplier after the frame's input was handled
+void InputRecording::RecordFrame(sf::Time delta, const std::vector<InputEvent>& events, const GamepadState& gamepad, float timeMultiplier)
+{
+	uint32_t frame = GetFrameCount();
+	m_frameMicroseconds.push_back(delta.asMicroseconds());
+
+	for (const InputEvent& event : events)
+	{
+		m_events.push_back({ frame, event });
+	}
+
+	// Only changes are stored; the first frame stores the initial values
+	if (frame == 0 || gamepad != m_lastGamepad)
+	{
+		m_gamepadChanges.push_back({ frame, gamepad });
+		m_lastGamepad = gamepad;
+	}
+	if (frame == 0 || timeMultiplier != m_lastMultiplier)
+	{
+		m_multiplierChanges.push_back({ frame, timeMultiplier });
+		m_lastMultiplier = timeMultiplier;
+	}
+}
+
+/// @brief Finish the recording
+/// @param endChecksum State checksum after the last frame
+void InputRecording::EndRecording(uint64_t endChecksum)
+{
+	m_endChecksum = endChecksum;
+}
+
+/// @brief Write the recording as JSON
+/// @param path Output file
+/// @return true if the file was written
+bool InputRecording::Save(const std::string& path) const
+{
+	std::ofstream file(path);
+	if (!file.is_open())
+	{
+		DebugLog("InputRecording - Could not write " + path, DebugType::Error);
+		return false;
+	}
+
+	Json::OStreamWrapper stream(file);
+	Json::PrettyWriter<Json::OStreamWrapper> writer(stream);
+	writer.StartObject();
+	writer.Key("version");
+	writer.Uint(s_fileVersion);
+	writer.Key("seed");
+	writer.Uint(m_seed);
+	writer.Key("startChecksum");
+	writer.Uint64(m_startChecksum);
+	writer.Key("endChecksum");
+	writer.Uint64(m_endChecksum);
+	writer.Key("startMouseX");
+	writer.Int(m_startMousePosition.x);
+	writer.Key("startMouseY");
+	writer.Int(m_startMousePosition.y);
+
+	writer.Key("frameMicroseconds");
+	writer.SetFormatOptions(Json::kFormatSingleLineArray);
+	writer.StartArray();
+	for (int64_t microseconds : m_frameMicroseconds)
+	{
+		writer.Int64(microseconds);
+	}
+	writer.EndArray();
+	writer.SetFormatOptions(Json::kFormatDefault);
+
+	writer.Key("events");
+	writer.StartArray();
+	for (const RecordedEvent& recorded : m_events)
+	{
+		writer.StartObject();
+		writer.Key("frame");
+		writer.Uint(recorded.m_frame);
+		writer.Key("type");
+		writer.Int(recorded.m_event.type);
+		WriteEventFields(writer, recorded.m_event);
+		writer.EndObject();
+	}
+	writer.EndArray();
+
+	writer.Key("gamepad");
+	writer.StartArray();
+	for (const RecordedGamepad& recorded : m_gamepadChanges)
+	{
+		const GamepadState& state = recorded.m_state;
+		writer.StartObject();
+		writer.Key("frame");
+		writer.Uint(recorded.m_frame);
+		writer.Key("connected");
+		writer.Bool(state.m_connected);
+		writer.Key("hasScrollAxis");
+		writer.Bool(state.m_hasScrollAxis);
+		writer.Key("buttonA");
+		writer.Bool(state.m_buttonA);
+		writer.Key("x");
+		writer.Double(state.m_axisX);
+		writer.Key("y");
+		writer.Double(state.m_axisY);
+		writer.Key("scroll");
+		writer.Double(state.m_axisScroll);
+		writer.EndObject();
+	}
+	writer.EndArray();
+
+	writer.Key("timeMultiplier");
+	writer.StartArray();
+	for (const RecordedMultiplier& recorded : m_multiplierChanges)
+	{
+		writer.StartObject();
+		writer.Key("frame");
+		writer.Uint(recorded.m_frame);
+		writer.Key("value");
+		writer.Double(recorded.m_value);
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.EndObject();
+	file << std::endl;
+
+	if (!file.good())
+	{
+		DebugLog("InputRecording - Could not write " + path, DebugType::Error);
+		return false;
+	}
+	DebugLog("InputRecording - " + std::to_string(GetFrameCount()) + " frames, " + std::to_string(m_events.size()) +
+		" events written to " + path);
+	return true;
+}
+
+/// @brief Read a recording for playback
+/// @param path File written by Save
+/// @return false if the file is missing, of another version or malformed
+bool InputRecording::Load(const std::string& path)
+{
+	std::ifstream stream(path);
+	if (!stream.is_open())
+	{
+		DebugLog("InputRecording - Could not open " + path, DebugType::Error);
+		return false;
+	}
+	std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+	Json::Document document;
+	document.Parse(fileData.c_str());
+	if (document.HasParseError() || !document.IsObject())
+	{
+		DebugLog("InputRecording - Invalid recording " + path + ": " +
+			std::string(Json::GetParseError_En(document.GetParseError())), DebugType::Error);
+		return false;
+	}
+
+	uint32_t version = 0;
+	if (!GetUint(document, "version", version) || version != s_fileVersion || !GetUint(document, "seed", m_seed))
+	{
+		DebugLog("InputRecording - " + path + " is not a version " + std::to_string(s_fileVersion) + " recording", DebugType::Error);
+		return false;
+	}
+	m_startChecksum = GetUint64(document, "startChecksum");
+	m_endChecksum = GetUint64(document, "endChecksum");
+	m_startMousePosition.x = GetInt(document, "startMouseX");
+	m_startMousePosition.y = GetInt(document, "startMouseY");
+
+	const char* arrays[] = { "frameMicroseconds", "events", "gamepad", "timeMultiplier" };
+	for (const char* name : arrays)
+	{
+		if (!document.HasMember(name) || !document[name].IsArray())
+		{
+			DebugLog("InputRecording - " + path + " misses the '" + name + "' array", DebugType::Error);
+			return false;
+		}
+	}
+
+	m_frameMicroseconds.clear();
+	for (const Json::Value& microseconds : document["frameMicroseconds"].GetArray())
+	{
+		m_frameMicroseconds.push_back(microseconds.IsInt64() ? microseconds.GetInt64() : 0);
+	}
+
+	// Entries are stored in frame order; anything else would be skipped by the playback cursors
+	uint32_t frame = 0;
+	m_events.clear();
+	for (const Json::Value& object : document["events"].GetArray())
+	{
+		if (!object.IsObject() || !GetUint(object, "frame", frame) || !object.HasMember("type") || !object["type"].IsInt() ||
+			(!m_events.empty() && frame < m_events.back().m_frame))
+		{
+			DebugLog("InputRecording - Invalid event " + std::to_string(m_events.size()) + " in " + path, DebugType::Error);
+			return false;
+		}
+		RecordedEvent recorded;
+		recorded.m_frame = frame;
+		recorded.m_event.type = static_cast<InputEvent::EventType>(object["type"].GetInt());
+		ReadEventFields(object, recorded.m_event);
+		m_events.push_back(recorded);
+	}
+
+	m_gamepadChanges.clear();
+	for (const Json::Value& object : document["gamepad"].GetArray())
+	{
+		if (!object.IsObject() || !GetUint(object, "frame", frame))
+		{
+			DebugLog("InputRecording - Invalid gamepad entry in " + path, DebugType::Error);
+			return false;
+		}
+		RecordedGamepad recorded;
+		recorded.m_frame = frame;
+		recorded.m_state.m_connected = GetBool(object, "connected");
+		recorded.m_state.m_hasScrollAxis = GetBool(object, "hasScrollAxis");
+		recorded.m_state.m_buttonA = GetBool(object, "buttonA");
+		recorded.m_state.m_axisX = GetFloat(object, "x");
+		recorded.m_state.m_axisY = GetFloat(object, "y");
+		recorded.m_state.m_axisScroll = GetFloat(object, "scroll");
+		m_gamepadChanges.push_back(recorded);
+	}
+
+	m_multiplierChanges.clear();
+	for (const Json::Value& object : document["timeMultiplier"].GetArray())
+	{
+		if (!object.IsObject() || !GetUint(object, "frame", frame))
+		{
+			DebugLog("InputRecording - Invalid time multiplier entry in " + path, DebugType::Error);
+			return false;
+		}
+		m_multiplierChanges.push_back({ frame, GetFloat(object, "value") });
+	}
+
+	m_nextEvent = 0;
+	m_nextGamepad = 0;
+	m_nextMultiplier = 0;
+	m_gamepad = GamepadState();
+	m_expectedMultiplier = 0.0f;
+
+	DebugLog("InputRecording - " + path + ": " + std::to_string(GetFrameCount()) + " frames, " +
+		std::to_string(m_events.size()) + " events, seed " + std::to_string(m_seed));
+	return true;
+}
+
+/// @brief Recorded frame time of a frame
+/// @param frame Frame index, below GetFrameCount()
+sf::Time InputRecording::GetFrameDelta(uint32_t frame) const
+{
+	return frame < m_frameMicroseconds.size() ? sf::microseconds(m_frameMicroseconds[frame]) : sf::Time::Zero;
+}
+
+/// @brief Push the recorded events of a frame into the input queue
+/// @param frame Frame about to be processed
+/// @param queue Queue InputHandle dispatches from; cleared first
+void InputRecording::QueueFrameInput(uint32_t frame, ui::InputQueue& queue)
+{
+	queue.Clear();
+	for (; m_nextEvent < m_events.size() && m_events[m_nextEvent].m_frame <= frame; ++m_nextEvent)
+	{
+		queue.Push(m_events[m_nextEvent].m_event);
+	}
+}
+
+/// @brief Recorded gamepad state of a frame
+/// @param frame Frame about to be processed
+const GamepadState& InputRecording::GetGamepadState(uint32_t frame)
+{
+	for (; m_nextGamepad < m_gamepadChanges.size() && m_gamepadChanges[m_nextGamepad].m_frame <= frame; ++m_nextGamepad)
+	{
+		m_gamepad = m_gamepadChanges[m_nextGamepad].m_state;
+	}
+	return m_gamepad;
+}
+
+/// @brief Compare the time multiplier after a frame's input with the recorded one
+/// @param frame Frame that was just processed
+/// @param timeMultiplier Current global time multiplier
+/// @return false if playback has drifted from the recording
+bool InputRecording::CheckTimeMultiplier(uint32_t frame, float timeMultiplier)
+{
+	for (; m_nextMultiplier < m_multiplierChanges.size() && m_multiplierChanges[m_nextMultiplier].m_frame <= frame; ++m_nextMultiplier)
+	{
+		m_expectedMultiplier = m_multiplierChanges[m_nextMultiplier].m_value;
+	}
+	return timeMultiplier == m_expectedMultiplier;
+}
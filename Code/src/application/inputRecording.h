@@ -0,0 +1,85 @@
+#pragma once
+#include "pch.h"
+#include "../framework/InputQueue.h"
+
+/// Gamepad values the application reads once per frame, live or from a recording
+struct GamepadState
+{
+	bool m_connected = false;
+	bool m_hasScrollAxis = false;   ///< Right stick vertical axis (R) is present
+	bool m_buttonA = false;
+	float m_axisX = 0.0f;           ///< Left stick, -100..100
+	float m_axisY = 0.0f;
+	float m_axisScroll = 0.0f;      ///< Right stick vertical, -100..100
+
+	bool operator==(const GamepadState& other) const;
+	bool operator!=(const GamepadState& other) const { return !(*this == other); }
+};
+
+/// A recorded session (--record=file) for deterministic playback (--playback=file).
+/// Holds the random seed, the starting mouse position and, per frame, the frame time, the dispatched input events and
+/// the gamepad state; replaying them with the same data files reproduces the session.
+/// Time multiplier changes and a final state checksum are stored as checks, so playback
+/// reports the first frame where it drifted from the recording.
+class InputRecording final
+{
+public:
+	InputRecording();
+
+	// Recording
+	void BeginRecording(uint32_t seed, uint64_t startChecksum, const sf::Vector2i& mousePosition);
+	void RecordFrame(sf::Time delta, const std::vector<InputEvent>& events, const GamepadState& gamepad, float timeMultiplier);
+	void EndRecording(uint64_t endChecksum);
+	bool Save(const std::string& path) const;
+
+	// Playback; frames must be asked for in increasing order
+	bool Load(const std::string& path);
+	uint32_t GetSeed() const { return m_seed; }
+	const sf::Vector2i& GetStartMousePosition() const { return m_startMousePosition; }
+	uint32_t GetFrameCount() const { return static_cast<uint32_t>(m_frameMicroseconds.size()); }
+	sf::Time GetFrameDelta(uint32_t frame) const;
+	void QueueFrameInput(uint32_t frame, ui::InputQueue& queue);
+	const GamepadState& GetGamepadState(uint32_t frame);
+	bool CheckTimeMultiplier(uint32_t frame, float timeMultiplier);
+	uint64_t GetStartChecksum() const { return m_startChecksum; }
+	uint64_t GetEndChecksum() const { return m_endChecksum; }
+
+private:
+	struct RecordedEvent
+	{
+		uint32_t m_frame;
+		InputEvent m_event;
+	};
+
+	struct RecordedGamepad
+	{
+		uint32_t m_frame;
+		GamepadState m_state;
+	};
+
+	struct RecordedMultiplier
+	{
+		uint32_t m_frame;
+		float m_value;
+	};
+
+	uint32_t m_seed;
+	uint64_t m_startChecksum;                       ///< State after initialization (detects other data files)
+	uint64_t m_endChecksum;                         ///< State after the last frame
+	sf::Vector2i m_startMousePosition;              ///< Pointer position before the first event
+	std::vector<int64_t> m_frameMicroseconds;       ///< Frame time of every frame
+	std::vector<RecordedEvent> m_events;            ///< In dispatch order
+	std::vector<RecordedGamepad> m_gamepadChanges;  ///< Gamepad state from this frame on
+	std::vector<RecordedMultiplier> m_multiplierChanges; ///< Global time multiplier after this frame
+
+	// Recording: last stored values, so only changes are written
+	GamepadState m_lastGamepad;
+	float m_lastMultiplier;
+
+	// Playback cursors
+	size_t m_nextEvent;
+	size_t m_nextGamepad;
+	size_t m_nextMultiplier;
+	GamepadState m_gamepad;
+	float m_expectedMultiplier;
+};
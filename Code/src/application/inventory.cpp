@@ -13,8 +13,11 @@ Inventory::~Inventory() = default;
 /// @param app Reference to the main application instance
 void Inventory::InventoryInitialize(Application* app)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Loaders, "InventoryInitialize");
+	STARTUP_PHASE("InventoryInitialize");
 	// Store application reference
 	m_application = app;
+	m_changeBus = app ? app->GetModelChangeBus() : nullptr;
 	DebugLog("Inventory - Application reference set");
 
 	//Starting money
@@ -31,17 +34,23 @@ void Inventory::InventoryInitialize(Application* app)
 	DebugLog("Player Inventory initialized with " + std::to_string(m_playerProducts.size()) + " products, each with quantity 1. Total volume: " + 
 			 std::to_string(m_currentInventoryVolume) + "/" + std::to_string(s_maxInventoryVolume));
 
-	// Initialize UI visual state
-	UpdateInventoryVisual();
+	// Initial UI state
+	MarkChanged(PlayerField::Money);
+	MarkChanged(PlayerField::InventoryVolume);
+	MarkChanged(PlayerField::InventoryContents);
 }
 
 /// @brief Load inventory products from JSON file
 /// @param path Path to the JSON file containing product data
 void Inventory::LoadInventoryProducts(const std::string& path)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Loaders, "LoadInventoryProducts");
+	MetricTimerScope loadTimer(MetricHistogram::DataLoadSeconds);
 	DebugLog("Loading Player Products from: " + path);
+	StartupAssetScope asset(path, StartupAssetKind::Json);
 	std::ifstream stream(path);
 	std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	asset.MarkRead(fileData.size());
 
 	Json::Document document;
 	document.Parse(fileData.c_str());
@@ -159,15 +168,19 @@ void Inventory::LoadInventoryProducts(const std::string& path)
 		newProduct.m_currentPrice = newProduct.m_basePrice;
 		newProduct.m_currentPlayerImpact = 0.0f;
 		newProduct.m_trendIncreased = false;
+		newProduct.m_newsImpact = 0.0f;
 
 		newProduct.m_quantity = 0; // Reset for next iteration
 		// Add to current inventory volume (quantity * volume)
 		m_currentInventoryVolume += newProduct.m_quantity * newProduct.m_volume;
 
+		m_productIndexById.emplace(newProduct.m_id, static_cast<uint32_t>(m_playerProducts.size()));
 		m_playerProducts.push_back(std::move(newProduct));
 
 	
 	}
+
+	RebuildSortedViews();
 }
 
 // === Inventory Management ===
@@ -184,12 +197,7 @@ uint32_t Inventory::GetCurrentMoney() const
 void Inventory::SetCurrentMoney(uint32_t money)
 {
 	m_currentMoney = money;
-	
-	// Update money display immediately
-	if (m_application && m_application->GetApplicationUI())
-	{
-		m_application->GetApplicationUI()->UpdateCurrentMoneyDisplay();
-	}
+	MarkChanged(PlayerField::Money);
 }
 
 /// @brief Get quantity of a specific product in inventory
@@ -197,10 +205,8 @@ void Inventory::SetCurrentMoney(uint32_t money)
 /// @return Quantity owned, 0 if product not found
 uint32_t Inventory::GetProductQuantity(const std::string& productId) const
 {
-	auto it = std::find_if(m_playerProducts.begin(), m_playerProducts.end(),
-		[&productId](const StockProduct& p) { return p.m_id == productId; });
-	
-	return (it != m_playerProducts.end()) ? it->m_quantity : 0;
+	const StockProduct* product = FindProduct(productId);
+	return product ? product->m_quantity : 0;
 }
 
 /// @brief Get total value of all products in inventory
@@ -236,6 +242,26 @@ const std::vector<StockProduct>& Inventory::GetPlayerProducts() const
 	return m_playerProducts;
 }
 
+// === Sorted Views ===
+
+/// @brief Get the held products in display order
+/// @param sortType Order to return
+/// @return Indices into GetPlayerProducts() of all products with quantity > 0, highest value first
+const std::vector<uint32_t>& Inventory::GetSortedProductIndices(InventorySortType sortType) const
+{
+	return m_sortedViews[static_cast<int>(sortType)];
+}
+
+/// @brief Get a held product by its position in a sort order
+/// @param sortType Order to use
+/// @param rank Position in that order (0 = highest value)
+/// @return Product at that position, nullptr if fewer products are held
+const StockProduct* Inventory::GetSortedProduct(InventorySortType sortType, size_t rank) const
+{
+	const std::vector<uint32_t>& view = GetSortedProductIndices(sortType);
+	return rank < view.size() ? &m_playerProducts[view[rank]] : nullptr;
+}
+
 // === Product Management ===
 
 /// @brief Add quantity to a product in inventory and update volume
@@ -243,6 +269,7 @@ const std::vector<StockProduct>& Inventory::GetPlayerProducts() const
 /// @param quantity Amount to add
 void Inventory::AddProduct(const std::string& productId, uint32_t quantity)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Inventory, "AddProduct");
 	if (quantity == 0)
 	{
 		return; // Nothing to add
@@ -257,7 +284,9 @@ void Inventory::AddProduct(const std::string& productId, uint32_t quantity)
 	}
 
 	// Add quantity
+	uint32_t oldQuantity = product->m_quantity;
 	product->m_quantity += quantity;
+	UpdateSortedViews(GetProductIndex(*product), oldQuantity, product->m_volume);
 
 	// Update inventory volume
 	float volumeAdded = quantity * product->m_volume;
@@ -269,8 +298,8 @@ void Inventory::AddProduct(const std::string& productId, uint32_t quantity)
 		", Volume added: " + std::to_string(volumeAdded) +
 		", Total volume: " + std::to_string(m_currentInventoryVolume) + "/" + std::to_string(s_maxInventoryVolume));
 
-	// Update UI to reflect volume changes
-	UpdateInventoryVisual();
+	MarkChanged(PlayerField::InventoryVolume);
+	MarkChanged(PlayerField::InventoryContents);
 }
 
 /// @brief Remove quantity from a product in inventory and update volume
@@ -278,6 +307,7 @@ void Inventory::AddProduct(const std::string& productId, uint32_t quantity)
 /// @param quantity Amount to remove
 void Inventory::RemoveProduct(const std::string& productId, uint32_t quantity)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Inventory, "RemoveProduct");
 	if (quantity == 0)
 	{
 		return; // Nothing to remove
@@ -300,7 +330,9 @@ void Inventory::RemoveProduct(const std::string& productId, uint32_t quantity)
 	}
 
 	// Remove quantity
+	uint32_t oldQuantity = product->m_quantity;
 	product->m_quantity -= quantity;
+	UpdateSortedViews(GetProductIndex(*product), oldQuantity, product->m_volume);
 
 	// Update inventory volume
 	float volumeRemoved = quantity * product->m_volume;
@@ -312,66 +344,234 @@ void Inventory::RemoveProduct(const std::string& productId, uint32_t quantity)
 		", Volume removed: " + std::to_string(volumeRemoved) +
 		", Total volume: " + std::to_string(m_currentInventoryVolume) + "/" + std::to_string(s_maxInventoryVolume));
 
-	// Update UI to reflect volume changes
-	UpdateInventoryVisual();
+	MarkChanged(PlayerField::InventoryVolume);
+	MarkChanged(PlayerField::InventoryContents);
 }
 
-// === UI Update ===
-
-/// @brief Update inventory visual elements (progress bar and volume display)
-/// @details Updates the volume progress bar with current volume/max volume ratio
-///          and displays the values in format "current/max"
-void Inventory::UpdateInventoryVisual()
+/// @brief Apply reloaded JSON data to a product held by the player
+/// Keeps the held quantity and recalculates the used volume if the product volume changed
+/// @param definition Product definition parsed from item_products.json
+void Inventory::UpdateProductDefinition(const StockProduct& definition)
 {
-	if (!m_application)
+	MEMORY_TAG_SCOPE(MemoryTag::Inventory, "UpdateProductDefinition");
+	StockProduct* product = FindProduct(definition.m_id);
+	if (product == nullptr)
 	{
-		DebugLog("UpdateInventoryVisual - No application reference", DebugType::Warning);
 		return;
 	}
 
-	// Get the volume progress bar from the UI
-	auto* volumeProgressBar = m_application->GetApplicationUI()->GetVolumeProgressBar();
-	if (!volumeProgressBar)
+	float oldVolume = product->m_volume;
+	if (!CopyProductDefinition(*product, definition))
 	{
-		DebugLog("UpdateInventoryVisual - Volume progress bar not found", DebugType::Warning);
 		return;
 	}
+	MarkChanged(PlayerField::InventoryContents);
 
-	// Calculate progress ratio (0.0 to 1.0)
-	float progressRatio = (s_maxInventoryVolume > 0.0f) ? (m_currentInventoryVolume / s_maxInventoryVolume) : 0.0f;
-	
-	// Ensure ratio stays within bounds
-	progressRatio = std::max(0.0f, std::min(1.0f, progressRatio));
-
-	// Set the progress bar value
-	volumeProgressBar->SetProgress(progressRatio);
-
-	// Create the display text in format "current/max"
-	std::ostringstream volumeText;
-	volumeText << std::fixed << std::setprecision(0) << m_currentInventoryVolume 
-	           << "/" << s_maxInventoryVolume << " VOL";
-
-	// Set the custom text (this will override the default percentage display)
-	volumeProgressBar->SetCustomText(volumeText.str());
-
-	// Update money display as well
-	m_application->GetApplicationUI()->UpdateCurrentMoneyDisplay();
+	if (oldVolume != product->m_volume)
+	{
+		UpdateSortedViews(GetProductIndex(*product), product->m_quantity, oldVolume);
 
-	DebugLog("UpdateInventoryVisual - Volume updated: " + volumeText.str() + 
-	         " (Progress: " + std::to_string(progressRatio * 100.0f) + "%)");
+		m_currentInventoryVolume = 0.0f;
+		for (const auto& playerProduct : m_playerProducts)
+		{
+			m_currentInventoryVolume += playerProduct.m_quantity * playerProduct.m_volume;
+		}
+		MarkChanged(PlayerField::InventoryVolume);
+	}
 }
 
 // === Private Helper Functions ===
 
+/// @brief Report a changed player value to the UI
+/// @param field Changed field
+void Inventory::MarkChanged(PlayerField field)
+{
+	if (m_changeBus)
+	{
+		m_changeBus->MarkPlayer(field);
+	}
+}
+
 /// @brief Find product in inventory by ID
 /// @param productId ID of the product to find
 /// @return Pointer to product if found, nullptr otherwise
 StockProduct* Inventory::FindProduct(const std::string& productId)
 {
-	auto it = std::find_if(m_playerProducts.begin(), m_playerProducts.end(),
-		[&productId](const StockProduct& p) { return p.m_id == productId; });
-	
-	return (it != m_playerProducts.end()) ? &(*it) : nullptr;
+	auto it = m_productIndexById.find(productId);
+	return (it != m_productIndexById.end()) ? &m_playerProducts[it->second] : nullptr;
 }
 
-	
+/// @brief Find product in inventory by ID
+/// @param productId ID of the product to find
+/// @return Pointer to product if found, nullptr otherwise
+const StockProduct* Inventory::FindProduct(const std::string& productId) const
+{
+	auto it = m_productIndexById.find(productId);
+	return (it != m_productIndexById.end()) ? &m_playerProducts[it->second] : nullptr;
+}
+
+/// @brief Get the position of a product in m_playerProducts
+/// @param product Product stored in m_playerProducts
+/// @return Index used by the sorted views
+uint32_t Inventory::GetProductIndex(const StockProduct& product) const
+{
+	return static_cast<uint32_t>(&product - m_playerProducts.data());
+}
+
+/// @brief Build the sort key of a product from given values
+/// @param sortType Order the key is used for
+/// @param productIndex Index of the product in m_playerProducts (tie breaker)
+/// @param quantity Held quantity
+/// @param volume Volume per item
+/// @return Sort key
+Inventory::SortKey Inventory::MakeSortKey(InventorySortType sortType, uint32_t productIndex, uint32_t quantity, float volume)
+{
+	SortKey key;
+	key.m_value = (sortType == InventorySortType::Volume) ? static_cast<double>(quantity) * volume : static_cast<double>(quantity);
+	key.m_productIndex = productIndex;
+	return key;
+}
+
+/// @brief Strict total order of the sorted views: higher value first, then lower product index
+/// @return true if a comes before b
+bool Inventory::IsOrderedBefore(const SortKey& a, const SortKey& b)
+{
+	if (a.m_value != b.m_value)
+	{
+		return a.m_value > b.m_value;
+	}
+	return a.m_productIndex < b.m_productIndex;
+}
+
+/// @brief Get the sort key of a product from its current values
+/// @param sortType Order the key is used for
+/// @param productIndex Index of the product in m_playerProducts
+/// @return Sort key
+Inventory::SortKey Inventory::GetSortKey(InventorySortType sortType, uint32_t productIndex) const
+{
+	const StockProduct& product = m_playerProducts[productIndex];
+	return MakeSortKey(sortType, productIndex, product.m_quantity, product.m_volume);
+}
+
+/// @brief Sort all held products from scratch (after loading)
+void Inventory::RebuildSortedViews()
+{
+	for (int type = 0; type < static_cast<int>(InventorySortType::MAX); ++type)
+	{
+		InventorySortType sortType = static_cast<InventorySortType>(type);
+		std::vector<uint32_t>& view = m_sortedViews[type];
+
+		view.clear();
+		for (uint32_t i = 0; i < m_playerProducts.size(); ++i)
+		{
+			if (m_playerProducts[i].m_quantity > 0)
+			{
+				view.push_back(i);
+			}
+		}
+
+		std::sort(view.begin(), view.end(), [this, sortType](uint32_t a, uint32_t b) {
+			return IsOrderedBefore(GetSortKey(sortType, a), GetSortKey(sortType, b));
+		});
+	}
+}
+
+/// @brief Move one product to its new place in every sorted view
+/// @param productIndex Index of the changed product in m_playerProducts
+/// @param oldQuantity Quantity before the change
+/// @param oldVolume Volume per item before the change
+/// @details Finds the old place with the old key and shifts only the entries between the old
+///          and the new place, so a trade costs O(log n + distance moved)
+void Inventory::UpdateSortedViews(uint32_t productIndex, uint32_t oldQuantity, float oldVolume)
+{
+	const StockProduct& product = m_playerProducts[productIndex];
+	bool wasHeld = oldQuantity > 0;
+	bool isHeld = product.m_quantity > 0;
+
+	for (int type = 0; type < static_cast<int>(InventorySortType::MAX); ++type)
+	{
+		InventorySortType sortType = static_cast<InventorySortType>(type);
+		std::vector<uint32_t>& view = m_sortedViews[type];
+		SortKey oldKey = MakeSortKey(sortType, productIndex, oldQuantity, oldVolume);
+		SortKey newKey = GetSortKey(sortType, productIndex);
+
+		// Entries other than the changed one still have their old keys, so searching works
+		// on both sides of it
+		auto isBefore = [this, sortType](uint32_t entry, const SortKey& key) {
+			return IsOrderedBefore(GetSortKey(sortType, entry), key);
+		};
+
+		if (!wasHeld)
+		{
+			if (isHeld)
+			{
+				view.insert(std::lower_bound(view.begin(), view.end(), newKey, isBefore), productIndex);
+			}
+			continue;
+		}
+
+		// The changed entry compares with its new values, so skip it while searching its old place
+		auto oldPos = std::lower_bound(view.begin(), view.end(), oldKey,
+			[this, sortType, productIndex](uint32_t entry, const SortKey& key) {
+				return entry != productIndex && IsOrderedBefore(GetSortKey(sortType, entry), key);
+			});
+		if (oldPos == view.end() || *oldPos != productIndex)
+		{
+			DebugLog("Inventory - Sorted view out of sync, rebuilding", DebugType::Warning);
+			RebuildSortedViews();
+			return;
+		}
+
+		if (!isHeld)
+		{
+			view.erase(oldPos);
+		}
+		else if (IsOrderedBefore(newKey, oldKey))
+		{
+			auto newPos = std::lower_bound(view.begin(), oldPos, newKey, isBefore);
+			std::rotate(newPos, oldPos, oldPos + 1);
+		}
+		else
+		{
+			auto newPos = std::lower_bound(oldPos + 1, view.end(), newKey, isBefore);
+			std::rotate(oldPos, oldPos + 1, newPos);
+		}
+	}
+}
+
+/// @brief Copy JSON defined product members
+/// @param product Product to update (runtime members are not touched)
+/// @param definition Product definition parsed from item_products.json
+/// @param changedFields Optional list receiving the names of changed members
+/// @return true if any member changed
+bool CopyProductDefinition(StockProduct& product, const StockProduct& definition, std::vector<std::string>* changedFields)
+{
+	bool changed = false;
+	auto copyField = [&changed, changedFields](auto& target, const auto& source, const char* name)
+	{
+		if (target != source)
+		{
+			target = source;
+			changed = true;
+			if (changedFields)
+			{
+				changedFields->push_back(name);
+			}
+		}
+	};
+
+	copyField(product.m_name, definition.m_name, "name");
+	copyField(product.m_volume, definition.m_volume, "volume");
+	copyField(product.m_basePrice, definition.m_basePrice, "basePrice");
+	copyField(product.m_playerImpact, definition.m_playerImpact, "playerImpact");
+	copyField(product.m_minPrice, definition.m_minPrice, "minPrice");
+	copyField(product.m_maxPrice, definition.m_maxPrice, "maxPrice");
+	copyField(product.m_trends, definition.m_trends, "trends");
+	copyField(product.m_itemRarity, definition.m_itemRarity, "itemRarity");
+	copyField(product.m_stackReplenishment, definition.m_stackReplenishment, "stackReplenishment");
+	copyField(product.m_sellStackRatio, definition.m_sellStackRatio, "sellStackRatio");
+	copyField(product.m_maxQuantity, definition.m_maxQuantity, "maxQuantity");
+	copyField(product.m_productInfo, definition.m_productInfo, "productInfo");
+
+	return changed;
+}
@@ -1,4 +1,6 @@
 #pragma once
+#include "modelChangeBus.h"
+#include <unordered_map>
 
 enum class RarityLevel : char
 {
@@ -9,6 +11,15 @@ enum class RarityLevel : char
 	MAX
 };
 
+/// @brief Inventory sort types for sorting inventory items
+enum class InventorySortType
+{
+	Volume,   // Sort by total volume (quantity * volume per item)
+	Quantity, // Sort by quantity
+
+	MAX
+};
+
 struct StockProduct final
 {
 	//Json defined members
@@ -33,9 +44,14 @@ struct StockProduct final
 	uint32_t m_currentPrice;
 	float m_currentPlayerImpact;
 	bool m_trendIncreased;
+	float m_newsImpact;         // Price impact of headlines shown during the current cycle
 
 };
 
+// Copies the JSON defined members of definition into product, leaving runtime state untouched.
+// Names of the members that differed are appended to changedFields when provided.
+bool CopyProductDefinition(StockProduct& product, const StockProduct& definition, std::vector<std::string>* changedFields = nullptr);
+
 class Application; // forward declaration
 
 class Inventory final
@@ -55,23 +71,45 @@ public:
 	float GetMaxInventoryVolume() const;
 	const std::vector<StockProduct>& GetPlayerProducts() const;
 
+	// === Sorted Views ===
+	// Held products (quantity > 0) in descending sort order, as indices into GetPlayerProducts().
+	// Kept up to date on every change, so the top K products are simply the first K entries.
+	const std::vector<uint32_t>& GetSortedProductIndices(InventorySortType sortType) const;
+	const StockProduct* GetSortedProduct(InventorySortType sortType, size_t rank) const;
+
 	// === Product Management ===
 	void AddProduct(const std::string& productId, uint32_t quantity);
 	void RemoveProduct(const std::string& productId, uint32_t quantity);
-
-	// === UI Update ===
-	void UpdateInventoryVisual();
+	void UpdateProductDefinition(const StockProduct& definition);
 
 private:
 	StockProduct* FindProduct(const std::string& productId);
+	const StockProduct* FindProduct(const std::string& productId) const;
+	uint32_t GetProductIndex(const StockProduct& product) const;
 	void LoadInventoryProducts(const std::string& path);
+	void MarkChanged(PlayerField field);
+
+	// Sort key of a product: higher values first, equal values by product index
+	struct SortKey
+	{
+		double m_value;
+		uint32_t m_productIndex;
+	};
+	static SortKey MakeSortKey(InventorySortType sortType, uint32_t productIndex, uint32_t quantity, float volume);
+	static bool IsOrderedBefore(const SortKey& a, const SortKey& b);
+	SortKey GetSortKey(InventorySortType sortType, uint32_t productIndex) const;
+	void RebuildSortedViews();
+	void UpdateSortedViews(uint32_t productIndex, uint32_t oldQuantity, float oldVolume);
 
 	// === System References ===
 	Application* m_application = nullptr;       ///< Reference to main application instance
+	ModelChangeBus* m_changeBus = nullptr;      ///< Receives the fields changed for the UI
 
 	uint32_t m_currentMoney;
 	float m_currentInventoryVolume;
 	std::vector<StockProduct> m_playerProducts;
+	std::unordered_map<std::string, uint32_t> m_productIndexById;      ///< Product ID -> index in m_playerProducts
+	std::vector<uint32_t> m_sortedViews[static_cast<int>(InventorySortType::MAX)]; ///< See GetSortedProductIndices
 	
 	static constexpr float s_maxInventoryVolume = 1000.0f;
 };
@@ -0,0 +1,241 @@
+#include "pch.h"
+#include "keywordMatcher.h"
+#include <algorithm>
+#include <cctype>
+#include <queue>
+
+KeywordMatcher::KeywordMatcher()
+	: m_built(false)
+{
+	AddState(0); // root
+}
+
+/// @brief Add a pattern to the automaton
+/// @param pattern Text to search for (matched case-insensitively)
+/// @param patternId Id reported for matches of this pattern
+/// @param wholeWord If true the match must also end at a word boundary
+void KeywordMatcher::AddPattern(const std::string& pattern, uint32_t patternId, bool wholeWord)
+{
+	if (pattern.empty())
+	{
+		return;
+	}
+
+	// Walk the trie, creating the missing states
+	int32_t state = 0;
+	for (char character : pattern)
+	{
+		unsigned char folded = Fold(character);
+		int32_t child = m_firstChild[state];
+		while (child >= 0 && m_label[child] != folded)
+		{
+			child = m_nextSibling[child];
+		}
+		if (child < 0)
+		{
+			child = AddState(folded);
+			m_nextSibling[child] = m_firstChild[state];
+			m_firstChild[state] = child;
+		}
+		state = child;
+	}
+
+	Pattern newPattern;
+	newPattern.m_id = patternId;
+	newPattern.m_length = static_cast<uint32_t>(pattern.size());
+	newPattern.m_wholeWord = wholeWord;
+	newPattern.m_nextAtState = -1;
+	int32_t patternIndex = static_cast<int32_t>(m_patterns.size());
+	m_patterns.push_back(newPattern);
+
+	// Appended, so patterns ending at the same state are reported in the order they were added
+	int32_t* link = &m_firstPattern[state];
+	while (*link >= 0)
+	{
+		link = &m_patterns[*link].m_nextAtState;
+	}
+	*link = patternIndex;
+	m_built = false;
+}
+
+/// @brief Compile the trie into the automaton
+/// Flattens the child lists into sorted edge arrays, fills the dense root row and
+/// computes failure and output links breadth-first. Missing edges are not filled in:
+/// FindAll follows failure links instead, which is still amortized linear in the text
+void KeywordMatcher::Build()
+{
+	const size_t stateCount = m_failure.size();
+	m_edgeBegin.assign(stateCount + 1, 0);
+	m_edgeBytes.clear();
+	m_edgeTargets.clear();
+	m_edgeBytes.reserve(stateCount - 1);
+	m_edgeTargets.reserve(stateCount - 1);
+
+	std::vector<std::pair<unsigned char, int32_t>> edges;
+	for (size_t state = 0; state < stateCount; ++state)
+	{
+		m_edgeBegin[state] = static_cast<uint32_t>(m_edgeBytes.size());
+		edges.clear();
+		for (int32_t child = m_firstChild[state]; child >= 0; child = m_nextSibling[child])
+		{
+			edges.emplace_back(m_label[child], child);
+		}
+		std::sort(edges.begin(), edges.end());
+		for (const auto& edge : edges)
+		{
+			m_edgeBytes.push_back(edge.first);
+			m_edgeTargets.push_back(edge.second);
+		}
+	}
+	m_edgeBegin[stateCount] = static_cast<uint32_t>(m_edgeBytes.size());
+
+	// Root: missing edges stay at the root
+	std::queue<int32_t> pending;
+	m_rootTransitions.assign(s_alphabetSize, 0);
+	for (uint32_t edge = m_edgeBegin[0]; edge < m_edgeBegin[1]; ++edge)
+	{
+		int32_t child = m_edgeTargets[edge];
+		m_rootTransitions[m_edgeBytes[edge]] = child;
+		m_failure[child] = 0;
+		m_outputLink[child] = 0;
+		pending.push(child);
+	}
+
+	while (!pending.empty())
+	{
+		int32_t state = pending.front();
+		pending.pop();
+
+		for (uint32_t edge = m_edgeBegin[state]; edge < m_edgeBegin[state + 1]; ++edge)
+		{
+			int32_t child = m_edgeTargets[edge];
+			int32_t fallback = Step(m_failure[state], m_edgeBytes[edge]);
+			m_failure[child] = fallback;
+			m_outputLink[child] = m_firstPattern[fallback] < 0 ? m_outputLink[fallback] : fallback;
+			pending.push(child);
+		}
+	}
+
+	m_built = true;
+}
+
+/// @brief Find all pattern occurrences in a text
+/// @param text Text to scan (does not need to be null-terminated)
+/// @param length Text length in bytes
+/// @param matches Cleared and filled with the matches in order of their end offset
+void KeywordMatcher::FindAll(const char* text, size_t length, std::vector<Match>& matches) const
+{
+	matches.clear();
+	assert(m_built);
+
+	int32_t state = 0;
+	for (size_t i = 0; i < length; ++i)
+	{
+		state = Step(state, Fold(text[i]));
+
+		int32_t output = m_firstPattern[state] < 0 ? m_outputLink[state] : state;
+		for (; output > 0; output = m_outputLink[output])
+		{
+			for (int32_t patternIndex = m_firstPattern[output]; patternIndex >= 0; patternIndex = m_patterns[patternIndex].m_nextAtState)
+			{
+				const Pattern& pattern = m_patterns[patternIndex];
+				size_t end = i + 1;
+				size_t begin = end - pattern.m_length;
+
+				// Word boundaries: never match inside a word, optionally allow trailing letters (stems)
+				if (begin > 0 && IsWordCharacter(text[begin - 1]))
+				{
+					continue;
+				}
+				if (pattern.m_wholeWord && end < length && IsWordCharacter(text[end]))
+				{
+					continue;
+				}
+
+				Match match;
+				match.m_patternId = pattern.m_id;
+				match.m_begin = static_cast<uint32_t>(begin);
+				match.m_end = static_cast<uint32_t>(end);
+				matches.push_back(match);
+			}
+		}
+	}
+}
+
+/// @brief Get the number of added patterns
+/// @return Pattern count
+size_t KeywordMatcher::GetPatternCount() const
+{
+	return m_patterns.size();
+}
+
+/// @brief Get the number of automaton states
+/// @return State count (including the root)
+size_t KeywordMatcher::GetStateCount() const
+{
+	return m_failure.size();
+}
+
+/// @brief Append an empty state
+/// @param label Byte on the trie edge into the state
+/// @return Index of the new state
+int32_t KeywordMatcher::AddState(unsigned char label)
+{
+	m_label.push_back(label);
+	m_firstChild.push_back(-1);
+	m_nextSibling.push_back(-1);
+	m_failure.push_back(0);
+	m_outputLink.push_back(0);
+	m_firstPattern.push_back(-1);
+	return static_cast<int32_t>(m_failure.size() - 1);
+}
+
+/// @brief Find the trie child of a state for one byte
+/// @param state State with compiled edges (after Build)
+/// @param character Folded input byte
+/// @return Child state, -1 if the trie has no such edge
+int32_t KeywordMatcher::FindChild(int32_t state, unsigned char character) const
+{
+	auto begin = m_edgeBytes.begin() + m_edgeBegin[state];
+	auto end = m_edgeBytes.begin() + m_edgeBegin[state + 1];
+	auto found = std::lower_bound(begin, end, character);
+	if (found == end || *found != character)
+	{
+		return -1;
+	}
+	return m_edgeTargets[found - m_edgeBytes.begin()];
+}
+
+/// @brief Automaton transition: the trie edge, or the edge of the longest suffix state that has one
+/// @param state Current state
+/// @param character Folded input byte
+/// @return Next state
+int32_t KeywordMatcher::Step(int32_t state, unsigned char character) const
+{
+	while (state != 0)
+	{
+		int32_t child = FindChild(state, character);
+		if (child >= 0)
+		{
+			return child;
+		}
+		state = m_failure[state];
+	}
+	return m_rootTransitions[character];
+}
+
+/// @brief Case folding used for both patterns and text
+/// @param character Input byte
+/// @return Lower-case ASCII byte, other bytes unchanged
+unsigned char KeywordMatcher::Fold(char character)
+{
+	return static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(character)));
+}
+
+/// @brief Check whether a byte is part of a word
+/// @param character Input byte
+/// @return true for ASCII letters and digits
+bool KeywordMatcher::IsWordCharacter(char character)
+{
+	return std::isalnum(static_cast<unsigned char>(character)) != 0;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "pch.h"
+
+/// Case-insensitive multi-pattern matcher (Aho-Corasick automaton).
+/// Patterns are added once, Build() compiles the trie into sorted per-state edge lists with
+/// failure links, and FindAll() then scans a text in a single pass regardless of the pattern count.
+/// Only the root keeps a dense 256-entry row, so memory grows by a few dozen bytes per state
+/// instead of a full row, which keeps catalogs with hundreds of thousands of names affordable.
+class KeywordMatcher final
+{
+public:
+	struct Match
+	{
+		uint32_t m_patternId;   ///< Id given to AddPattern
+		uint32_t m_begin;       ///< Offset of the first matched character
+		uint32_t m_end;         ///< Offset one past the last matched character
+	};
+
+	KeywordMatcher();
+
+	// wholeWord: the match must end at a word boundary ("Nanochip" but not "Nanochips");
+	// every match must start at a word boundary
+	void AddPattern(const std::string& pattern, uint32_t patternId, bool wholeWord);
+	void Build();
+	void FindAll(const char* text, size_t length, std::vector<Match>& matches) const;
+
+	size_t GetPatternCount() const;
+	size_t GetStateCount() const;
+
+private:
+	struct Pattern
+	{
+		uint32_t m_id;          ///< User supplied id
+		uint32_t m_length;      ///< Pattern length in bytes
+		bool m_wholeWord;       ///< Requires a word boundary after the match
+		int32_t m_nextAtState;  ///< Next pattern ending at the same state, -1 if none
+	};
+
+	int32_t AddState(unsigned char label);
+	int32_t FindChild(int32_t state, unsigned char character) const;
+	int32_t Step(int32_t state, unsigned char character) const;
+	static unsigned char Fold(char character);
+	static bool IsWordCharacter(char character);
+
+	static constexpr size_t s_alphabetSize = 256;
+
+	std::vector<Pattern> m_patterns;                       ///< All added patterns
+
+	// Trie as first-child / next-sibling lists while patterns are added
+	std::vector<unsigned char> m_label;                    ///< Byte on the edge into each state
+	std::vector<int32_t> m_firstChild;                     ///< First child of each state, -1 if none
+	std::vector<int32_t> m_nextSibling;                    ///< Next child of the same parent, -1 if none
+
+	// Compiled by Build()
+	std::vector<int32_t> m_rootTransitions;                ///< Byte -> state from the root; missing edges stay at the root
+	std::vector<uint32_t> m_edgeBegin;                     ///< First edge of each state (one extra entry closes the last state)
+	std::vector<unsigned char> m_edgeBytes;                ///< Edge bytes, sorted within each state
+	std::vector<int32_t> m_edgeTargets;                    ///< Child state of each edge
+	std::vector<int32_t> m_failure;                        ///< Longest proper suffix state
+	std::vector<int32_t> m_outputLink;                     ///< Nearest suffix state that ends a pattern, 0 if none
+	std::vector<int32_t> m_firstPattern;                   ///< First pattern ending exactly at each state, -1 if none
+	bool m_built;                                          ///< Build() has run since the last AddPattern()
+};
@@ -2,14 +2,15 @@
 #include "pch.h"
 #include "application.h"
 
-int main()
+int main(int argc, char* argv[])
 {
-
+  int exitCode = 0;
   if( auto app = std::make_unique<Application>() )
   {
+    app->ParseCommandLine(argc, argv);
     app->Initialize();
-    app->Run();
+    exitCode = app->Run();
   }
 
-  return 0;
+  return exitCode;
 }
\ No newline at end of file
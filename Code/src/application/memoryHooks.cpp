@@ -0,0 +1,98 @@
+#include "pch.h"
+#include <new>
+
+// Global operator new/delete routed through the MemoryTracker. Kept in the executable rather
+// than in the core library so the linker always picks these replacements up.
+#if MEMORY_TRACKING_ENABLED
+
+namespace
+{
+	/// @brief Allocate through the tracker, calling the new handler until it succeeds
+	/// @param size Bytes requested
+	/// @return The allocated block, nullptr if no new handler is installed
+	void* AllocateTracked(size_t size)
+	{
+		if (size == 0)
+		{
+			size = 1;
+		}
+		for (;;)
+		{
+			void* memory = MemoryTracker::Get().Allocate(size);
+			if (memory)
+			{
+				return memory;
+			}
+			std::new_handler handler = std::get_new_handler();
+			if (!handler)
+			{
+				return nullptr;
+			}
+			handler();
+		}
+	}
+}
+
+void* operator new(size_t size)
+{
+	void* memory = AllocateTracked(size);
+	if (!memory)
+	{
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	try
+	{
+		return AllocateTracked(size);
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept
+{
+	return operator new(size, tag);
+}
+
+void operator delete(void* memory) noexcept
+{
+	MemoryTracker::Get().Free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	MemoryTracker::Get().Free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	MemoryTracker::Get().Free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+	MemoryTracker::Get().Free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+	MemoryTracker::Get().Free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+	MemoryTracker::Get().Free(memory);
+}
+
+#endif
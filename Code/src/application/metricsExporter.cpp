@@ -0,0 +1,256 @@
+#include "pch.h"
+#include "metricsExporter.h"
+#include "utilTools.h"
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+
+constexpr int MetricsExporter::s_pollMilliseconds;
+constexpr int MetricsExporter::s_requestTimeoutMilliseconds;
+constexpr size_t MetricsExporter::s_maxRequestBytes;
+
+namespace
+{
+	/// @brief Write one gauge family with a single sample
+	void WriteGauge(std::ostream& stream, const char* name, const char* help, double value)
+	{
+		stream << "# HELP " << name << " " << help << "\n"
+			<< "# TYPE " << name << " gauge\n"
+			<< name << " " << value << "\n";
+	}
+
+	/// @brief Size of a file in bytes, 0 if it does not exist
+	size_t GetFileSize(const std::string& path)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		return file.is_open() ? static_cast<size_t>(file.tellg()) : 0;
+	}
+}
+
+/// @brief Create an exporter; nothing runs until Start
+/// @param settings Options from the command line
+MetricsExporter::MetricsExporter(const MetricsExportSettings& settings)
+	: m_settings(settings)
+	, m_listening(false)
+	, m_stopping(false)
+	, m_startTime(std::chrono::steady_clock::now())
+	, m_tradesPerMinute(0.0)
+	, m_failedFileWrites(0)
+{
+}
+
+/// @brief Stops the export thread
+MetricsExporter::~MetricsExporter()
+{
+	Stop();
+}
+
+/// @brief Open the HTTP endpoint and start the export thread
+/// @return false if the port could not be opened; the file export still runs then
+bool MetricsExporter::Start()
+{
+	bool endpointOpen = true;
+	if (m_settings.m_port != 0)
+	{
+		if (m_listener.listen(m_settings.m_port, sf::IpAddress(m_settings.m_address)) == sf::Socket::Done)
+		{
+			m_selector.add(m_listener);
+			m_listening = true;
+			DebugLog("Metrics - Serving http://" + m_settings.m_address + ":" + std::to_string(m_settings.m_port) + "/metrics");
+		}
+		else
+		{
+			DebugLog("Metrics - Could not listen on " + m_settings.m_address + ":" + std::to_string(m_settings.m_port), DebugType::Error);
+			endpointOpen = false;
+		}
+	}
+	if (!m_settings.m_filePath.empty())
+	{
+		DebugLog("Metrics - Appending snapshots to " + m_settings.m_filePath + " every " +
+			std::to_string(static_cast<int>(m_settings.m_fileIntervalSeconds)) + " s");
+	}
+
+	if (m_listening || !m_settings.m_filePath.empty())
+	{
+		m_stopping = false;
+		m_thread = std::thread(&MetricsExporter::ThreadLoop, this);
+	}
+	return endpointOpen;
+}
+
+/// @brief Stop the export thread, close the endpoint and write a last file snapshot
+void MetricsExporter::Stop()
+{
+	if (!m_thread.joinable())
+		return;
+
+	m_stopping = true;
+	m_thread.join();
+	m_listener.close();
+	m_listening = false;
+	if (!m_settings.m_filePath.empty() && !WriteFileSnapshot())
+	{
+		++m_failedFileWrites;
+	}
+	if (m_failedFileWrites > 0)
+	{
+		DebugLog("Metrics - " + std::to_string(m_failedFileWrites) + " snapshots could not be written to " + m_settings.m_filePath, DebugType::Error);
+	}
+}
+
+/// @brief Export thread: accepts scrapes, samples the trade rate and writes file snapshots
+void MetricsExporter::ThreadLoop()
+{
+	TRACE_THREAD_NAME("MetricsExporter");
+	using Clock = std::chrono::steady_clock;
+	Clock::time_point nextSample = Clock::now();
+	Clock::time_point nextFileWrite = nextSample + std::chrono::milliseconds(static_cast<int>(m_settings.m_fileIntervalSeconds * 1000.0f));
+
+	while (!m_stopping)
+	{
+		if (m_listening)
+		{
+			if (m_selector.wait(sf::milliseconds(s_pollMilliseconds)) && m_selector.isReady(m_listener))
+			{
+				sf::TcpSocket client;
+				if (m_listener.accept(client) == sf::Socket::Done)
+				{
+					ServeClient(client);
+				}
+			}
+		}
+		else
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(s_pollMilliseconds));
+		}
+
+		Clock::time_point now = Clock::now();
+		if (now >= nextSample)
+		{
+			SampleTradeRate(now);
+			nextSample += std::chrono::seconds(1);
+		}
+		if (!m_settings.m_filePath.empty() && now >= nextFileWrite)
+		{
+			if (!WriteFileSnapshot())
+			{
+				++m_failedFileWrites;
+			}
+			nextFileWrite = now + std::chrono::milliseconds(static_cast<int>(m_settings.m_fileIntervalSeconds * 1000.0f));
+		}
+	}
+}
+
+/// @brief Answer one HTTP request: the metrics for GET /metrics (or /), 404 otherwise
+/// @param client Accepted connection; closed when the function returns
+/// A client that does not send its request within the timeout is dropped
+void MetricsExporter::ServeClient(sf::TcpSocket& client)
+{
+	sf::SocketSelector clientSelector;
+	clientSelector.add(client);
+	std::string request;
+	char buffer[512];
+	while (request.find("\r\n\r\n") == std::string::npos && request.size() < s_maxRequestBytes)
+	{
+		std::size_t received = 0;
+		if (!clientSelector.wait(sf::milliseconds(s_requestTimeoutMilliseconds)) ||
+			client.receive(buffer, sizeof(buffer), received) != sf::Socket::Done)
+		{
+			return;
+		}
+		request.append(buffer, received);
+	}
+
+	std::string status = "200 OK";
+	std::string body;
+	if (request.compare(0, 13, "GET /metrics ") == 0 || request.compare(0, 6, "GET / ") == 0)
+	{
+		body = BuildSnapshot();
+	}
+	else
+	{
+		status = "404 Not Found";
+		body = "Metrics are served at /metrics\n";
+	}
+
+	std::string response = "HTTP/1.1 " + status + "\r\n"
+		"Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+		"Content-Length: " + std::to_string(body.size()) + "\r\n"
+		"Connection: close\r\n\r\n" + body;
+	client.send(response.data(), response.size());
+	client.disconnect();
+}
+
+/// @brief Record the trade counter and update the trades per minute over the last minute
+/// @param now Time of the sample
+void MetricsExporter::SampleTradeRate(std::chrono::steady_clock::time_point now)
+{
+	m_tradeSamples.emplace_back(now, Metrics::Get().GetCounter(MetricCounter::Trades));
+	while (m_tradeSamples.size() > 2 && now - m_tradeSamples[1].first >= std::chrono::minutes(1))
+	{
+		m_tradeSamples.pop_front();
+	}
+
+	// Extrapolated from a shorter span during the first minute
+	std::chrono::duration<double> span = now - m_tradeSamples.front().first;
+	uint64_t trades = m_tradeSamples.back().second - m_tradeSamples.front().second;
+	m_tradesPerMinute = span.count() > 0.0 ? static_cast<double>(trades) * 60.0 / span.count() : 0.0;
+}
+
+/// @brief Render the registry and the exporter's own gauges in the Prometheus text format
+std::string MetricsExporter::BuildSnapshot() const
+{
+	std::ostringstream stream;
+	Metrics::Get().WritePrometheus(stream);
+
+	std::chrono::duration<double> uptime = std::chrono::steady_clock::now() - m_startTime;
+	stream << std::fixed << std::setprecision(3);
+	WriteGauge(stream, "hytr_uptime_seconds", "Time since the metrics export started", uptime.count());
+	WriteGauge(stream, "hytr_trades_per_minute", "Trades executed over the last minute", m_tradesPerMinute);
+	stream << std::setprecision(0);
+	// Left out rather than reported as 0 when the platform query fails
+	size_t peakMemory = GetPeakMemoryBytes();
+	if (peakMemory > 0)
+	{
+		WriteGauge(stream, "hytr_peak_memory_bytes", "Peak working set (resident set on POSIX) of the process", static_cast<double>(peakMemory));
+	}
+	if (MemoryTracker::IsEnabled())
+	{
+		WriteGauge(stream, "hytr_heap_live_bytes", "Heap bytes allocated and not freed (MEMORY_TRACKING_ENABLED builds)",
+			static_cast<double>(MemoryTracker::Get().GetTotalStats().m_liveBytes));
+	}
+	return stream.str();
+}
+
+/// @brief Append a timestamped snapshot to the metrics file, rotating it first when it would grow too large
+/// @return false if the file could not be written
+bool MetricsExporter::WriteFileSnapshot()
+{
+	std::string snapshot = "# snapshot unix_time=" + std::to_string(static_cast<long long>(std::time(nullptr))) + "\n" + BuildSnapshot() + "\n";
+	if (GetFileSize(m_settings.m_filePath) + snapshot.size() > m_settings.m_fileMaxBytes)
+	{
+		RotateFiles();
+	}
+
+	std::ofstream file(m_settings.m_filePath, std::ios::app);
+	file << snapshot;
+	return file.good();
+}
+
+/// @brief Shift <file>.1 .. <file>.N-1 up by one, dropping the oldest, and move the file to <file>.1
+void MetricsExporter::RotateFiles() const
+{
+	const std::string& path = m_settings.m_filePath;
+	if (m_settings.m_fileKeepCount == 0)
+	{
+		std::remove(path.c_str());
+		return;
+	}
+
+	std::remove((path + "." + std::to_string(m_settings.m_fileKeepCount)).c_str());
+	for (uint32_t index = m_settings.m_fileKeepCount - 1; index >= 1; --index)
+	{
+		std::rename((path + "." + std::to_string(index)).c_str(), (path + "." + std::to_string(index + 1)).c_str());
+	}
+	std::rename(path.c_str(), (path + ".1").c_str());
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "pch.h"
+#include <SFML/Network.hpp>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <thread>
+
+/// Options of the metrics export (--metrics-port, --metrics-file and related command line options)
+struct MetricsExportSettings
+{
+	unsigned short m_port = 0;                       ///< HTTP port serving GET /metrics; 0 disables the endpoint
+	std::string m_address = "127.0.0.1";             ///< Interface the endpoint listens on
+	std::string m_filePath;                          ///< Snapshots are appended to this file when set
+	float m_fileIntervalSeconds = 60.0f;             ///< Time between two file snapshots
+	size_t m_fileMaxBytes = 4 * 1024 * 1024;         ///< The file is rotated before it grows past this size
+	uint32_t m_fileKeepCount = 5;                    ///< Rotated files kept as <file>.1 (newest) to <file>.N
+};
+
+/// Publishes the Metrics registry for fleet monitoring of unattended installations.
+/// A background thread serves the Prometheus text format on a local HTTP endpoint
+/// (sf::TcpListener, one request per connection) and appends timestamped snapshots to a
+/// size-rotated file. Besides the registry it reports uptime, trades per minute and memory.
+/// Only the export thread reads the atomics, so the instrumented code never waits for it.
+class MetricsExporter final
+{
+public:
+	explicit MetricsExporter(const MetricsExportSettings& settings);
+	~MetricsExporter();
+
+	bool Start();
+	void Stop(); // Writes a last file snapshot
+
+private:
+	void ThreadLoop();
+	void ServeClient(sf::TcpSocket& client);
+	void SampleTradeRate(std::chrono::steady_clock::time_point now);
+	std::string BuildSnapshot() const;
+	bool WriteFileSnapshot();
+	void RotateFiles() const;
+
+	MetricsExportSettings m_settings;
+	sf::TcpListener m_listener;
+	sf::SocketSelector m_selector;
+	bool m_listening;
+	std::thread m_thread;
+	std::atomic<bool> m_stopping;
+	std::chrono::steady_clock::time_point m_startTime;
+
+	// Trade counter sampled once per second over the last minute (export thread only)
+	std::deque<std::pair<std::chrono::steady_clock::time_point, uint64_t>> m_tradeSamples;
+	double m_tradesPerMinute;
+	uint32_t m_failedFileWrites;                     ///< Reported by Stop: the export thread does not log
+
+	static constexpr int s_pollMilliseconds = 250;       ///< Longest wait of the thread for a connection
+	static constexpr int s_requestTimeoutMilliseconds = 1000;
+	static constexpr size_t s_maxRequestBytes = 4096;
+};
@@ -0,0 +1,102 @@
+#include "pch.h"
+#include "modelChangeBus.h"
+#include <algorithm>
+
+/// @brief Get the changed fields of a product
+/// @param productIndex Index of the product in the stock market
+/// @return ProductField bits, 0 if nothing changed
+uint32_t ModelChanges::GetProductFields(uint32_t productIndex) const
+{
+	return productIndex < m_productFields.size() ? m_productFields[productIndex] : 0;
+}
+
+/// @brief Check whether a product field changed
+/// @param productIndex Index of the product in the stock market
+/// @param field Field to check
+/// @return true if the field was marked
+bool ModelChanges::Has(uint32_t productIndex, ProductField field) const
+{
+	return (GetProductFields(productIndex) & static_cast<uint32_t>(field)) != 0;
+}
+
+/// @brief Check whether a player field changed
+/// @param field Field to check
+/// @return true if the field was marked
+bool ModelChanges::Has(PlayerField field) const
+{
+	return (m_playerFields & static_cast<uint32_t>(field)) != 0;
+}
+
+/// @brief Check whether anything changed
+/// @return true if no field was marked
+bool ModelChanges::IsEmpty() const
+{
+	return m_changedProducts.empty() && m_playerFields == 0;
+}
+
+/// @brief Forget all marked fields
+void ModelChanges::Clear()
+{
+	for (uint32_t productIndex : m_changedProducts)
+	{
+		m_productFields[productIndex] = 0;
+	}
+	m_changedProducts.clear();
+	m_playerFields = 0;
+}
+
+/// @brief Make room for the given number of products without losing marked fields
+/// @param productCount Number of products that can be marked without allocating
+void ModelChanges::Reserve(size_t productCount)
+{
+	if (m_productFields.size() < productCount)
+	{
+		m_productFields.resize(productCount, 0);
+	}
+	m_changedProducts.reserve(productCount);
+}
+
+/// @brief Size the pending changes for every product
+/// @param productCount Number of products in the stock market
+void ModelChangeBus::Reserve(size_t productCount)
+{
+	m_productCount = std::max(m_productCount, productCount);
+	m_pending.Reserve(m_productCount);
+}
+
+/// @brief Mark a product field as changed
+/// @param productIndex Index of the product in the stock market
+/// @param field Changed field
+void ModelChangeBus::MarkProduct(uint32_t productIndex, ProductField field)
+{
+	if (productIndex >= m_pending.m_productFields.size())
+	{
+		m_pending.m_productFields.resize(productIndex + 1, 0);
+	}
+
+	uint32_t& fields = m_pending.m_productFields[productIndex];
+	if (fields == 0)
+	{
+		m_pending.m_changedProducts.push_back(productIndex);
+	}
+	fields |= static_cast<uint32_t>(field);
+}
+
+/// @brief Mark a player field as changed
+/// @param field Changed field
+void ModelChangeBus::MarkPlayer(PlayerField field)
+{
+	m_pending.m_playerFields |= static_cast<uint32_t>(field);
+}
+
+/// @brief Hand all pending changes to the consumer
+/// @param changes Receives the changes; its previous content is discarded
+void ModelChangeBus::Drain(ModelChanges& changes)
+{
+	changes.Clear();
+	std::swap(changes, m_pending);
+
+	// The consumer's storage becomes the pending one; size it here (outside the market
+	// cycle) when it has not seen every product yet, so the next marks do not allocate
+	m_pending.Reserve(m_productCount);
+}
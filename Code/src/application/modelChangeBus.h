@@ -0,0 +1,57 @@
+#pragma once
+#include "pch.h"
+
+/// Product values shown by widgets; used as bits in ModelChanges
+enum class ProductField : uint32_t
+{
+	Quantity = 1 << 0,      ///< Stock quantity or max quantity
+	Price = 1 << 1,         ///< Current price
+	Trend = 1 << 2,         ///< Price direction
+	Definition = 1 << 3,    ///< Name or other JSON defined members (hot reload)
+};
+
+/// Player values shown by widgets; used as bits in ModelChanges
+enum class PlayerField : uint32_t
+{
+	Money = 1 << 0,                 ///< Current money
+	InventoryVolume = 1 << 1,       ///< Used inventory volume
+	InventoryContents = 1 << 2,     ///< Held products or their quantities
+};
+
+/// Dirty bits collected between two drains, keyed by the product's index in the stock market.
+/// Clear only resets the products that were marked, so a frame costs O(changed products)
+/// however large the catalog is, and the storage is kept for the next frame.
+struct ModelChanges final
+{
+	std::vector<uint32_t> m_productFields;    ///< Product index -> ProductField bits, 0 if unchanged
+	std::vector<uint32_t> m_changedProducts;  ///< Indices with bits in m_productFields, in marking order
+	uint32_t m_playerFields = 0;              ///< PlayerField bits
+
+	uint32_t GetProductFields(uint32_t productIndex) const;
+	bool Has(uint32_t productIndex, ProductField field) const;
+	bool Has(PlayerField field) const;
+	bool IsEmpty() const;
+	void Clear();
+	void Reserve(size_t productCount);
+};
+
+/// Change notifications from the model (StockMarket, Inventory) to the UI.
+/// The model only marks which fields changed; the UI drains the bus once per frame
+/// and refreshes the widgets bound to those fields, so several changes in one frame
+/// cost one refresh and the model does not depend on ApplicationUI.
+class ModelChangeBus final
+{
+public:
+	/// Sizes the storage for every product, so marking does not allocate (the market cycle
+	/// runs in a MEMORY_NO_ALLOC_SCOPE); called by the stock market after loading products
+	void Reserve(size_t productCount);
+	void MarkProduct(uint32_t productIndex, ProductField field);
+	void MarkPlayer(PlayerField field);
+
+	/// Moves the pending changes into changes (cleared first) and resets the bus
+	void Drain(ModelChanges& changes);
+
+private:
+	ModelChanges m_pending;     ///< Changes marked since the last drain
+	size_t m_productCount = 0;  ///< Products reserved for, in both m_pending and the drained changes
+};
@@ -2,20 +2,26 @@
 #include "stockMarket.h"
 #include "utilTools.h"
 #include "application.h"
-#include "applicationUI.h"
+#include "keywordMatcher.h"
+#include <cstring>
+#include <unordered_map>
 
 /// @brief Initialize the entire stock market system
 /// Loads all data files and sets up initial market state
 /// @param app Reference to the main application instance
 void StockMarket::InitializeStockMarket(Application* app)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Loaders, "InitializeStockMarket");
+	STARTUP_PHASE("InitializeStockMarket");
 	// Store application reference
 	m_application = app;
+	m_changeBus = app ? app->GetModelChangeBus() : nullptr;
 	DebugLog("StockMarket - Application reference set");
 
 	// Reset market timing
 	m_currentCycleTime = 4.5f;
 	m_cycleCount = 0;
+	m_tradeCount = 0;
 
 	// Load stock products from JSON
 	std::ostringstream pathBuilder;
@@ -37,6 +43,12 @@ void StockMarket::InitializeStockMarket(Application* app)
 	// Initialize random starting values for all products
 	InitializeProductValues();
 
+	// Pick up economy edits made while the game is running
+	if (m_dataHotReload)
+	{
+		StartDataHotReload();
+	}
+
 	DebugLog("Stock Market initialization completed");
 	//DebugLog(m_stockProducts[3].m_name);
 
@@ -50,6 +62,7 @@ void StockMarket::InitializeStockMarket(Application* app)
 /// @param delta Time elapsed since last frame
 void StockMarket::StockMarketUpdate(sf::Time delta)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Market, "StockMarketUpdate");
 	// Only update cycle timer if not in trade pause
 	if (m_application && !m_application->m_inTradePause)
 	{
@@ -60,9 +73,7 @@ void StockMarket::StockMarketUpdate(sf::Time delta)
 		if (m_currentCycleTime >= s_stockCycleTime)
 		{
 			// Execute market cycle: price updates, stock replenishment, trend shifts
-			m_currentCycleTime = 0.0f;  // Reset cycle timer
-			m_cycleCount++;             // Increment cycle counter
-			StockMarketCycleStep();     // Perform all market updates
+			RunMarketCycle();
 		}
 	}
 
@@ -71,17 +82,47 @@ void StockMarket::StockMarketUpdate(sf::Time delta)
 
 }
 
+/// @brief Start a market cycle now, as the cycle timer does when it expires
+/// Used by the timer and by scripted runs (headless, scenario tool) that force cycles
+void StockMarket::RunMarketCycle()
+{
+	m_currentCycleTime = 0.0f;  // Reset cycle timer
+	m_cycleCount++;             // Increment cycle counter
+	StockMarketCycleStep();     // Perform all market updates
+}
+
 /// @brief Execute one complete market cycle
 /// Updates trends, reduces player impact, replenishes stock, and recalculates prices
 void StockMarket::StockMarketCycleStep()
 {
-	DebugLog("Market Cycle #" + std::to_string(m_cycleCount) + " executing");
+	PROFILE_SCOPE("StockMarketCycleStep");
+	MEMORY_TAG_SCOPE(MemoryTag::Market, "StockMarketCycleStep");
+
+	// Apply data file edits at the cycle boundary so a cycle never mixes old and new values.
+	// A reload parses and logs, so it stays outside the no-alloc check below: it only runs
+	// after an edit of the data files, never in steady-state play
+	ApplyPendingDataReload();
+
+	if (IsDebugLogEnabled(DebugType::Verbose))
+	{
+		DebugLog("Market Cycle #" + std::to_string(m_cycleCount) + " executing", DebugType::Verbose);
+	}
+
+	// The rest of the cycle must not allocate (verbose logging aside): the change bus is sized
+	// for every product at load
+	MEMORY_NO_ALLOC_SCOPE("StockMarketCycleStep");
+	TRACE_COUNTER("MarketCycle", m_cycleCount);
+	Metrics::Get().Add(MetricCounter::MarketCycles);
 
 	// Update trend pointers for all stock products
 	for (auto& product : m_stockProducts)
 	{
+		uint32_t oldQuantity = product.m_quantity;
+		uint32_t oldPrice = product.m_currentPrice;
+		bool oldTrendIncreased = product.m_trendIncreased;
+
 		product.m_trendPointer++;
-		if (product.m_trendPointer > 49)
+		if (product.m_trendPointer >= product.m_trends.size())
 		{
 			product.m_trendPointer = 0;
 		}
@@ -94,14 +135,143 @@ void StockMarket::StockMarketCycleStep()
 
 		// Calculate and update current price
 		CalculateProductPrice(product);
+
+		// News impact applies to the cycle in which the headline was shown
+		product.m_newsImpact = 0.0f;
+
+		// Tell the UI which monitor values changed
+		MarkProductChanges(product, oldQuantity, oldPrice, oldTrendIncreased);
+	}
+}
+
+/// @brief Report the displayed values of a product that changed
+/// @param product Product after the update
+/// @param oldQuantity Stock quantity before the update
+/// @param oldPrice Price before the update
+/// @param oldTrendIncreased Trend direction before the update
+void StockMarket::MarkProductChanges(const StockProduct& product, uint32_t oldQuantity, uint32_t oldPrice, bool oldTrendIncreased)
+{
+	if (!m_changeBus)
+	{
+		return;
+	}
+
+	const uint32_t productIndex = GetProductIndex(product);
+	if (product.m_quantity != oldQuantity)
+	{
+		m_changeBus->MarkProduct(productIndex, ProductField::Quantity);
+	}
+	if (product.m_currentPrice != oldPrice)
+	{
+		m_changeBus->MarkProduct(productIndex, ProductField::Price);
+	}
+	if (product.m_trendIncreased != oldTrendIncreased)
+	{
+		m_changeBus->MarkProduct(productIndex, ProductField::Trend);
+	}
+}
+
+/// @brief Start watching the data folder for edits to the product catalog
+/// Changed files are reparsed on the watcher thread and applied by ApplyPendingDataReload
+void StockMarket::StartDataHotReload()
+{
+	STARTUP_PHASE("StartDataHotReload");
+	m_dataWatcher.Start(Application::s_dataPath, { "item_products.json" },
+		[this](const std::string& fileName) { OnDataFileChanged(fileName); });
+}
+
+/// @brief Reparse a changed data file (runs on the data watcher thread)
+/// The result is staged and applied at the next market cycle boundary
+/// @param fileName Name of the changed file inside the data folder
+void StockMarket::OnDataFileChanged(const std::string& fileName)
+{
+	std::unique_ptr<StockProductCatalog> catalog = std::make_unique<StockProductCatalog>(ParseJsonStockProducts(Application::s_dataPath + fileName));
+
+	// A newer edit replaces one that has not been applied yet
+	std::lock_guard<std::mutex> lock(m_pendingReloadMutex);
+	m_pendingProductCatalog = std::move(catalog);
+}
+
+/// @brief Apply a reparsed product catalog to the live market
+/// Only JSON defined members are updated; quantity, trend pointer, prices and player
+/// impact are preserved and clamped to the new limits
+void StockMarket::ApplyPendingDataReload()
+{
+	std::unique_ptr<StockProductCatalog> catalog;
+	{
+		std::lock_guard<std::mutex> lock(m_pendingReloadMutex);
+		catalog = std::move(m_pendingProductCatalog);
+	}
+	if (!catalog)
+	{
+		return;
 	}
 
-	// Update UI displays with new product data
-	if (m_application && m_application->GetApplicationUI())
+	for (const std::string& warning : catalog->m_warnings)
 	{
-		m_application->GetApplicationUI()->UpdateProductDisplays();
+		DebugLog("Hot reload - " + warning, DebugType::Warning);
+	}
+	if (!catalog->m_error.empty())
+	{
+		// Keep the live catalog; the next save will be picked up again
+		DebugLog("Hot reload - " + catalog->m_error, DebugType::Error);
+		return;
 	}
-}/// @brief Update cycle timer (mainly for debugging purposes)
+
+	Inventory* inventory = m_application ? m_application->GetPlayerInventory() : nullptr;
+	uint32_t changedProducts = 0;
+
+	for (const StockProduct& definition : catalog->m_products)
+	{
+		StockProduct* product = GetStockProductById(definition.m_id);
+		if (product == nullptr)
+		{
+			DebugLog("Hot reload - New product " + definition.m_id + " ignored, adding products requires a restart", DebugType::Warning);
+			continue;
+		}
+
+		std::vector<std::string> changedFields;
+		if (!CopyProductDefinition(*product, definition, &changedFields))
+		{
+			continue;
+		}
+		changedProducts++;
+
+		// Name and max quantity are displayed; prices follow at the end of this cycle
+		if (m_changeBus)
+		{
+			m_changeBus->MarkProduct(GetProductIndex(*product), ProductField::Definition);
+			m_changeBus->MarkProduct(GetProductIndex(*product), ProductField::Quantity);
+		}
+
+		// Keep runtime state valid against the new limits
+		if (product->m_trendPointer >= product->m_trends.size())
+		{
+			product->m_trendPointer = product->m_trends.empty() ? 0 : static_cast<uint32_t>(product->m_trends.size() - 1);
+		}
+		product->m_quantity = std::min(product->m_quantity, product->m_maxQuantity);
+
+		if (inventory)
+		{
+			inventory->UpdateProductDefinition(definition);
+		}
+
+		std::string fieldList;
+		for (const std::string& field : changedFields)
+		{
+			fieldList += (fieldList.empty() ? "" : ", ") + field;
+		}
+		DebugLog("Hot reload - " + product->m_id + " updated: " + fieldList);
+	}
+
+	if (catalog->m_products.size() != m_stockProducts.size())
+	{
+		DebugLog("Hot reload - Product count changed, removing products requires a restart", DebugType::Warning);
+	}
+	DebugLog("Hot reload - item_products.json applied, " + std::to_string(changedProducts) + " products changed");
+}
+
+/// @brief Update cycle timer (mainly for debugging purposes)
 /// Currently disabled but can be used to monitor cycle timing
 void StockMarket::CycleTimerUpdate()
 {
@@ -113,144 +283,160 @@ void StockMarket::CycleTimerUpdate()
 /// @param path Full path to the JSON file to load
 void StockMarket::LoadJsonStockProducts(const std::string& path)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Loaders, "LoadJsonStockProducts");
+	STARTUP_PHASE("LoadJsonStockProducts");
 	DebugLog("Loading Stock Products from: " + path);
+	StockProductCatalog catalog = ParseJsonStockProducts(path);
+
+	for (const std::string& warning : catalog.m_warnings)
+	{
+		DebugLog(warning, DebugType::Warning);
+	}
+
+	if (!catalog.m_error.empty())
+	{
+		DebugLog(catalog.m_error, DebugType::Error);
+		DebugLog("Skipping JSON loading due to parse error");
+		return;
+	}
+
+	for (StockProduct& product : catalog.m_products)
+	{
+		m_stockProducts.push_back(std::move(product));
+	}
+	if (m_changeBus)
+	{
+		m_changeBus->Reserve(m_stockProducts.size());
+	}
+}
+
+/// @brief Parse stock product definitions from a JSON file
+/// Touches no market state and does not log, so it is safe to call from the data watcher thread
+/// @param path Full path to the JSON file to parse
+/// @return Parsed catalog; m_error is set and m_products is empty if the file is invalid
+StockProductCatalog StockMarket::ParseJsonStockProducts(const std::string& path)
+{
+	MEMORY_TAG_SCOPE(MemoryTag::Loaders, "ParseJsonStockProducts");
+	MetricTimerScope loadTimer(MetricHistogram::DataLoadSeconds);
+	StartupAssetScope asset(path, StartupAssetKind::Json);
+	StockProductCatalog catalog;
+
 	std::ifstream stream(path);
 	if (!stream.is_open()) {
-		DebugLog("Failed to open file: " + path);
+		catalog.m_error = "Failed to open file: " + path;
+		asset.Complete(false);
+		return catalog;
 	}
 	std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
-	DebugLog("File data size: " + std::to_string(fileData.size()));
+	asset.MarkRead(fileData.size());
 
 	Json::Document document;
 	document.Parse(fileData.c_str());
 	if (document.HasParseError()) {
-		DebugLog("JSON Parse Error: " + std::string(Json::GetParseError_En(document.GetParseError())));
-		DebugLog("JSON Parse Error Offset: " + std::to_string(document.GetErrorOffset()));
-		DebugLog("File size: " + std::to_string(fileData.size()));
-		if (!fileData.empty()) {
-			DebugLog("First 100 chars: " + fileData.substr(0, std::min(100, (int)fileData.size())));
-		}
-		DebugLog("Skipping JSON loading due to parse error");
-		return; // Return early instead of asserting
+		asset.Complete(false);
+		catalog.m_error = "JSON Parse Error: " + std::string(Json::GetParseError_En(document.GetParseError())) +
+			" at offset " + std::to_string(document.GetErrorOffset()) + " in " + path;
+		return catalog;
 	}
 
-	assert(document.IsObject());
-
 	//products
-	assert(document.HasMember("products"));
+	if (!document.IsObject() || !document.HasMember("products") || !document["products"].IsArray()) {
+		asset.Complete(false);
+		catalog.m_error = "JSON document has no 'products' array: " + path;
+		return catalog;
+	}
+
+	// Field readers - a file saved mid-edit must produce an error, not an assert
+	std::string missingField;
+	auto readString = [&missingField](const Json::Value& object, const char* name, std::string& out)
+	{
+		if (!object.HasMember(name) || !object[name].IsString()) { missingField = name; return; }
+		out = object[name].GetString();
+	};
+	auto readFloat = [&missingField](const Json::Value& object, const char* name, float& out)
+	{
+		if (!object.HasMember(name) || !object[name].IsNumber()) { missingField = name; return; }
+		out = object[name].GetFloat();
+	};
+	auto readUint = [&missingField](const Json::Value& object, const char* name, uint32_t& out)
+	{
+		if (!object.HasMember(name) || !object[name].IsInt() || object[name].GetInt() < 0) { missingField = name; return; }
+		out = static_cast<uint32_t>(object[name].GetInt());
+	};
+
 	const Json::Value& arrayObject = document["products"];
-	assert(arrayObject.IsArray());
 	for (Json::SizeType i = 0; i < arrayObject.Size(); i++)
 	{
-		StockProduct newProduct;
-
-		// id
-		assert(arrayObject[i].HasMember("id"));
-		assert(arrayObject[i]["id"].IsString());
-		newProduct.m_id = arrayObject[i]["id"].GetString();
-
-		// name
-		assert(arrayObject[i].HasMember("name"));
-		assert(arrayObject[i]["name"].IsString());
-		newProduct.m_name = arrayObject[i]["name"].GetString();
-
-		//volume
-		assert(arrayObject[i].HasMember("volume"));
-		assert(arrayObject[i]["volume"].IsFloat());
-		newProduct.m_volume = arrayObject[i]["volume"].GetFloat();
-
-		//basePrice
-		assert(arrayObject[i].HasMember("basePrice"));
-		assert(arrayObject[i]["basePrice"].IsInt());
-		newProduct.m_basePrice = static_cast<uint32_t>(arrayObject[i]["basePrice"].GetInt());
-
-		//volume
-		assert(arrayObject[i].HasMember("volume"));
-		assert(arrayObject[i]["volume"].IsFloat());
-		newProduct.m_volume = arrayObject[i]["volume"].GetFloat();
-
-		//playerImpact
-		assert(arrayObject[i].HasMember("playerImpact"));
-		assert(arrayObject[i]["playerImpact"].IsFloat());
-		newProduct.m_playerImpact = arrayObject[i]["playerImpact"].GetFloat();
-
-		//minPrice
-		assert(arrayObject[i].HasMember("minPrice"));
-		assert(arrayObject[i]["minPrice"].IsFloat());
-		newProduct.m_minPrice = arrayObject[i]["minPrice"].GetFloat();
-
-		//maxPrice
-		assert(arrayObject[i].HasMember("maxPrice"));
-		assert(arrayObject[i]["maxPrice"].IsFloat());
-		newProduct.m_maxPrice = arrayObject[i]["maxPrice"].GetFloat();
+		const Json::Value& productObject = arrayObject[i];
+		StockProduct newProduct = {};
+
+		readString(productObject, "id", newProduct.m_id);
+		readString(productObject, "name", newProduct.m_name);
+		readFloat(productObject, "volume", newProduct.m_volume);
+		readUint(productObject, "basePrice", newProduct.m_basePrice);
+		readFloat(productObject, "playerImpact", newProduct.m_playerImpact);
+		readFloat(productObject, "minPrice", newProduct.m_minPrice);
+		readFloat(productObject, "maxPrice", newProduct.m_maxPrice);
+		readUint(productObject, "stackReplenishment", newProduct.m_stackReplenishment);
+		readFloat(productObject, "sellStackRatio", newProduct.m_sellStackRatio);
+		readUint(productObject, "maxQuantity", newProduct.m_maxQuantity);
+		readString(productObject, "productInfo", newProduct.m_productInfo);
 
 		//m_trends
-		assert(arrayObject[i].HasMember("trends"));
-		const Json::Value& internalArrayObject = arrayObject[i]["trends"];
-		assert(internalArrayObject.IsArray());
-		for (Json::SizeType i = 0; i < internalArrayObject.Size(); i++)
+		if (productObject.HasMember("trends") && productObject["trends"].IsArray())
 		{
-			assert(internalArrayObject[i].IsFloat());
-			newProduct.m_trends.push_back(internalArrayObject[i].GetFloat());
+			const Json::Value& internalArrayObject = productObject["trends"];
+			for (Json::SizeType j = 0; j < internalArrayObject.Size(); j++)
+			{
+				if (!internalArrayObject[j].IsNumber()) { missingField = "trends"; break; }
+				newProduct.m_trends.push_back(internalArrayObject[j].GetFloat());
+			}
+		}
+		else
+		{
+			missingField = "trends";
 		}
 
-		// itemRarity (now read as string and converted to enum)
-		assert(arrayObject[i].HasMember("itemRarity"));
-		assert(arrayObject[i]["itemRarity"].IsString());
+		// itemRarity (read as string and converted to enum)
+		std::string rarityStr;
+		readString(productObject, "itemRarity", rarityStr);
+		if (rarityStr == "Rare")
 		{
-			std::string rarityStr = arrayObject[i]["itemRarity"].GetString();
-			// map string to enum
-			if (rarityStr == "Rare")
-			{
-				newProduct.m_itemRarity = RarityLevel::Rare;
-			}
-			else if (rarityStr == "Normal")
-			{
-				newProduct.m_itemRarity = RarityLevel::Normal;
-			}
-			else if (rarityStr == "Common")
-			{
-				newProduct.m_itemRarity = RarityLevel::Common;
-			}
-			else
+			newProduct.m_itemRarity = RarityLevel::Rare;
+		}
+		else if (rarityStr == "Normal")
+		{
+			newProduct.m_itemRarity = RarityLevel::Normal;
+		}
+		else
+		{
+			// Unknown value: fallback to Common
+			if (rarityStr != "Common")
 			{
-				// Unknown value: log and fallback to Common
-				DebugLog("Unknown itemRarity value: " + rarityStr + " ; defaulting to Common", DebugType::Warning);
-				newProduct.m_itemRarity = RarityLevel::Common;
+				catalog.m_warnings.push_back("Unknown itemRarity value: " + rarityStr + " ; defaulting to Common");
 			}
+			newProduct.m_itemRarity = RarityLevel::Common;
 		}
 
-		//stackReplenishment
-		assert(arrayObject[i].HasMember("stackReplenishment"));
-		assert(arrayObject[i]["stackReplenishment"].IsInt());
-		newProduct.m_stackReplenishment = static_cast<uint32_t>(arrayObject[i]["stackReplenishment"].GetInt());
-
-		//sellStackRatio
-		assert(arrayObject[i].HasMember("sellStackRatio"));
-		assert(arrayObject[i]["sellStackRatio"].IsFloat());
-		newProduct.m_sellStackRatio = arrayObject[i]["sellStackRatio"].GetFloat();
-
-		//maxQuantity
-		assert(arrayObject[i].HasMember("maxQuantity"));
-		assert(arrayObject[i]["maxQuantity"].IsInt());
-		newProduct.m_maxQuantity = static_cast<uint32_t>(arrayObject[i]["maxQuantity"].GetInt());
-
-		//productInfo
-		assert(arrayObject[i].HasMember("productInfo"));
-		assert(arrayObject[i]["productInfo"].IsString());
-		newProduct.m_productInfo = arrayObject[i]["productInfo"].GetString();
+		if (!missingField.empty())
+		{
+			asset.Complete(false);
+			catalog.m_error = "Product " + std::to_string(i) + " has missing or invalid '" + missingField + "' in " + path;
+			catalog.m_products.clear();
+			return catalog;
+		}
 
-		m_stockProducts.push_back(std::move(newProduct));
+		catalog.m_products.push_back(std::move(newProduct));
 	}
+
+	return catalog;
 }
 
 /// @brief Initialize random starting values for all loaded products
 /// Sets random quantities, trend pointers, player impact, and calculates initial prices
 void StockMarket::InitializeProductValues()
 {
-	// Create uniform distribution for trend pointer (0-49)
-	std::uniform_int_distribution<uint32_t> trendDistribution(0, 49);
-
+	STARTUP_PHASE("InitializeProductValues");
 	// Create uniform distribution for random boolean (trend increased)
 	std::uniform_int_distribution<int> boolDistribution(0, 1);
 
@@ -263,16 +449,22 @@ void StockMarket::InitializeProductValues()
 		// Set random quantity
 		product.m_quantity = quantityDistribution(Application::GetRandomGenerator());
 
-		// Set random trend pointer between 0 and 49
+		// Set random trend pointer within the product's trend curve
+		uint32_t lastTrendIndex = product.m_trends.empty() ? 0 : static_cast<uint32_t>(product.m_trends.size() - 1);
+		std::uniform_int_distribution<uint32_t> trendDistribution(0, lastTrendIndex);
 		product.m_trendPointer = trendDistribution(Application::GetRandomGenerator());
 
 		// Initialize current player impact to 0
 		product.m_currentPlayerImpact = 0.0f;
+		product.m_newsImpact = 0.0f;
 
 		// Set random trend increased flag
 		product.m_trendIncreased = boolDistribution(Application::GetRandomGenerator()) == 1;
 
-		DebugLog("Product: " + product.m_name + " - Random quantity: " + std::to_string(product.m_quantity) + "/" + std::to_string(product.m_maxQuantity) + ", Trend pointer: " + std::to_string(product.m_trendPointer) + ", Initial price calculated");
+		if (IsDebugLogEnabled(DebugType::Verbose))
+		{
+			DebugLog("Product: " + product.m_name + " - Random quantity: " + std::to_string(product.m_quantity) + "/" + std::to_string(product.m_maxQuantity) + ", Trend pointer: " + std::to_string(product.m_trendPointer) + ", Initial price calculated", DebugType::Verbose);
+		}
 
 		// Calculate initial price
 		CalculateProductPrice(product);
@@ -315,8 +507,11 @@ void StockMarket::CalculateProductPrice(StockProduct& product)
 	}
 
 
+	// Apply the impact of headlines shown during this cycle
+	float newsImpactFactor = 1.0f + product.m_newsImpact;
+
 	// Calculate and store price without player impact (ensure minimum value of 1)
-	product.m_currentPriceWithoutPlayerImpact = std::max(1u, static_cast<uint32_t>(product.m_basePrice * baseTrendPrice * randomInfluenceFactor));
+	product.m_currentPriceWithoutPlayerImpact = std::max(1u, static_cast<uint32_t>(product.m_basePrice * baseTrendPrice * randomInfluenceFactor * newsImpactFactor));
 
 	// Calculate current price: basePrice * aggregated multiplier (ensure minimum value of 1)
 	uint32_t newPrice = std::max(1u, static_cast<uint32_t>(playerImpactMultiplier * product.m_currentPriceWithoutPlayerImpact));
@@ -351,6 +546,9 @@ void StockMarket::CalculateProductPrice(StockProduct& product)
 /// @param product Reference to the product to update
 void StockMarket::CalculateOnlyPlayerInfluenceChangePrice(StockProduct& product)
 {
+	uint32_t oldPrice = product.m_currentPrice;
+	bool oldTrendIncreased = product.m_trendIncreased;
+
 	// Apply player impact multiplier
 	float playerImpactMultiplier = 1.0f;
 	if (product.m_currentPlayerImpact > 0.0f)
@@ -389,10 +587,7 @@ void StockMarket::CalculateOnlyPlayerInfluenceChangePrice(StockProduct& product)
 	// 	", Final Price: " + std::to_string(product.m_currentPrice) +
 	// 	", Trend Increased: " + (product.m_trendIncreased ? "true" : "false"));
 
-	if (m_application && m_application->GetApplicationUI())
-	{
-		m_application->GetApplicationUI()->UpdateProductDisplays();
-	}
+	MarkProductChanges(product, product.m_quantity, oldPrice, oldTrendIncreased);
 }
 
 /// @brief Reduce player impact on product price over time
@@ -416,10 +611,10 @@ void StockMarket::ReducePlayerImpact(StockProduct& product)
 		}
 
 		// Debug log if there was a change
-		if (oldImpact != product.m_currentPlayerImpact)
+		if (oldImpact != product.m_currentPlayerImpact && IsDebugLogEnabled(DebugType::Verbose))
 		{
 			DebugLog("Product: " + product.m_name + " - Player impact reduced from " +
-				std::to_string(oldImpact) + " to " + std::to_string(product.m_currentPlayerImpact));
+				std::to_string(oldImpact) + " to " + std::to_string(product.m_currentPlayerImpact), DebugType::Verbose);
 		}
 	}
 }
@@ -443,12 +638,12 @@ void StockMarket::ProductStockReplenishment(StockProduct& product)
 	product.m_quantity = std::min(product.m_maxQuantity, product.m_quantity + replenishmentAmount);
 
 	// Debug log the replenishment
-	if (replenishmentAmount > 0)
+	if (replenishmentAmount > 0 && IsDebugLogEnabled(DebugType::Verbose))
 	{
 		DebugLog("Product: " + product.m_name + " - Stock replenished: +" + std::to_string(replenishmentAmount) +
 			" (multiplier: " + std::to_string(randomMultiplier) + "), " +
 			"Quantity: " + std::to_string(oldQuantity) + " -> " + std::to_string(product.m_quantity) +
-			"/" + std::to_string(product.m_maxQuantity));
+			"/" + std::to_string(product.m_maxQuantity), DebugType::Verbose);
 	}
 }
 
@@ -470,6 +665,21 @@ StockProduct* StockMarket::GetStockProductById(const std::string& productId)
 	return nullptr;
 }
 
+/// @brief Find the index of a stock product, as used by the change bus
+/// @param productId The product ID to search for
+/// @return Index in the product list, -1 if not found
+int32_t StockMarket::GetStockProductIndex(const std::string& productId) const
+{
+	for (size_t i = 0; i < m_stockProducts.size(); ++i)
+	{
+		if (m_stockProducts[i].m_id == productId)
+		{
+			return static_cast<int32_t>(i);
+		}
+	}
+	return -1;
+}
+
 /// @brief Get vendor by associated product ID
 /// @param productId ID of the product to find the associated vendor for
 /// @return Pointer to StockVendor if found, nullptr otherwise
@@ -610,6 +820,7 @@ bool StockMarket::ValidateSellForStock(const std::string& productId, uint32_t de
 /// @return true if successful, false if insufficient stock or product not found
 bool StockMarket::BuyFromStock(const std::string& productId, uint32_t quantity)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Market, "BuyFromStock");
 	// Use validation function to check all prerequisites (stock, money, inventory space)
 	if (!ValidateBuyFromStock(productId, quantity))
 	{
@@ -654,11 +865,14 @@ bool StockMarket::BuyFromStock(const std::string& productId, uint32_t quantity)
 	// Update price based on player impact after purchase
 	CalculateOnlyPlayerInfluenceChangePrice(*product);
 
-	// Update money display and inventory buttons in UI
-	if (m_application && m_application->GetApplicationUI())
+	m_tradeCount++;
+	TRACE_COUNTER("Trades", m_tradeCount);
+	Metrics::Get().Add(MetricCounter::Trades);
+
+	// Stock quantity changed; money and inventory are reported by Inventory
+	if (m_changeBus)
 	{
-		m_application->GetApplicationUI()->UpdateCurrentMoneyDisplay();
-		m_application->GetApplicationUI()->UpdateInventoryVerticalButtons();
+		m_changeBus->MarkProduct(GetProductIndex(*product), ProductField::Quantity);
 	}
 
 	return true;
@@ -671,6 +885,7 @@ bool StockMarket::BuyFromStock(const std::string& productId, uint32_t quantity)
 /// @return true if successful, false if insufficient quantity in inventory or product not found
 bool StockMarket::SellForStock(const std::string& productId, uint32_t quantity)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Market, "SellForStock");
 	// Use validation function to check if player has enough quantity in inventory
 	if (!ValidateSellForStock(productId, quantity))
 	{
@@ -720,11 +935,14 @@ bool StockMarket::SellForStock(const std::string& productId, uint32_t quantity)
 	// Update price based on player impact after sale
 	CalculateOnlyPlayerInfluenceChangePrice(*product);
 
-	// Update money display and inventory buttons in UI
-	if (m_application && m_application->GetApplicationUI())
+	m_tradeCount++;
+	TRACE_COUNTER("Trades", m_tradeCount);
+	Metrics::Get().Add(MetricCounter::Trades);
+
+	// Stock quantity changed; money and inventory are reported by Inventory
+	if (m_changeBus)
 	{
-		m_application->GetApplicationUI()->UpdateCurrentMoneyDisplay();
-		m_application->GetApplicationUI()->UpdateInventoryVerticalButtons();
+		m_changeBus->MarkProduct(GetProductIndex(*product), ProductField::Quantity);
 	}
 
 	return true;
@@ -735,17 +953,24 @@ bool StockMarket::SellForStock(const std::string& productId, uint32_t quantity)
 /// @param path Full path to the JSON file to load
 void StockMarket::LoadJsonStockVendors(const std::string& path)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Loaders, "LoadJsonStockVendors");
+	STARTUP_PHASE("LoadJsonStockVendors");
+	MetricTimerScope loadTimer(MetricHistogram::DataLoadSeconds);
 	DebugLog("Loading Stock Vendors from: " + path);
+	StartupAssetScope asset(path, StartupAssetKind::Json);
 	std::ifstream stream(path);
 
 	if (!stream.is_open()) {
 		DebugLog("ERROR: Could not open file: " + path);
+		asset.Complete(false);
 		return; // Gracefully handle the error instead of assertion
 	}
 
 	std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	asset.MarkRead(fileData.size());
 
 	if (fileData.empty()) {
+		asset.Complete(false);
 		DebugLog("ERROR: File is empty: " + path);
 		return; // Gracefully handle the error instead of assertion
 	}
@@ -756,6 +981,7 @@ void StockMarket::LoadJsonStockVendors(const std::string& path)
 	document.Parse(fileData.c_str());
 
 	if (document.HasParseError()) {
+		asset.Complete(false);
 		DebugLog("ERROR: JSON Parse Error at offset " + std::to_string(document.GetErrorOffset()));
 		DebugLog("ERROR: " + std::string(Json::GetParseError_En(document.GetParseError())));
 		DebugLog("File content preview (first 200 chars): " + fileData.substr(0, 200));
@@ -763,17 +989,20 @@ void StockMarket::LoadJsonStockVendors(const std::string& path)
 	}
 
 	if (!document.IsObject()) {
+		asset.Complete(false);
 		DebugLog("ERROR: JSON document is not an object: " + path);
 		return;
 	}
 
 	//characters
 	if (!document.HasMember("characters")) {
+		asset.Complete(false);
 		DebugLog("ERROR: JSON document missing 'characters' member: " + path);
 		return;
 	}
 	const Json::Value& arrayObject = document["characters"];
 	if (!arrayObject.IsArray()) {
+		asset.Complete(false);
 		DebugLog("ERROR: 'characters' is not an array: " + path);
 		return;
 	}
@@ -880,50 +1109,254 @@ void StockMarket::LoadJsonStockVendors(const std::string& path)
 	DebugLog("Loaded " + std::to_string(m_stockVendors.size()) + " stock vendors");
 }
 
+namespace
+{
+	/// SAX handler collecting the strings of the top-level "news" array.
+	/// With in-situ parsing the strings stay inside the file buffer, so no DOM and no
+	/// per-headline allocation is needed even for very large corpora
+	struct NewsCollector : public Json::BaseReaderHandler<Json::UTF8<>, NewsCollector>
+	{
+		NewsCollector(std::vector<News>& news, std::vector<std::pair<std::string, float>>& sentiment)
+			: m_news(news), m_sentiment(sentiment) {}
+
+		bool StartObject()
+		{
+			++m_depth;
+			m_inSentimentObject = m_sentimentKeyPending && m_depth == 2;
+			m_newsKeyPending = false;
+			m_sentimentKeyPending = false;
+			return true;
+		}
+		bool EndObject(Json::SizeType)
+		{
+			if (m_depth == 2)
+			{
+				m_inSentimentObject = false;
+			}
+			--m_depth;
+			return true;
+		}
+		bool StartArray()
+		{
+			++m_depth;
+			m_inNewsArray = m_newsKeyPending && m_depth == 2;
+			m_newsKeyPending = false;
+			m_sentimentKeyPending = false;
+			return true;
+		}
+		bool EndArray(Json::SizeType)
+		{
+			if (m_depth == 2)
+			{
+				m_inNewsArray = false;
+			}
+			--m_depth;
+			return true;
+		}
+		bool Key(const char* str, Json::SizeType length, bool)
+		{
+			m_newsKeyPending = (m_depth == 1 && length == 4 && std::strncmp(str, "news", 4) == 0);
+			m_sentimentKeyPending = (m_depth == 1 && length == 9 && std::strncmp(str, "sentiment", 9) == 0);
+			if (m_inSentimentObject && m_depth == 2)
+			{
+				m_keyword.assign(str, length);
+			}
+			return true;
+		}
+		bool String(const char* str, Json::SizeType length, bool)
+		{
+			if (m_inNewsArray && m_depth == 2)
+			{
+				News news;
+				news.m_newsContent = str;
+				news.m_newsLength = length;
+				news.m_currentNewsIndex = static_cast<uint32_t>(m_news.size());
+				news.m_impact = 0.0f;
+				news.m_tagOffset = 0;
+				news.m_tagCount = 0;
+				m_news.push_back(news);
+			}
+			m_newsKeyPending = false;
+			m_sentimentKeyPending = false;
+			return true;
+		}
+		bool Int(int value) { return Number(value); }
+		bool Uint(unsigned value) { return Number(value); }
+		bool Double(double value) { return Number(value); }
+		bool Number(double value)
+		{
+			// "sentiment": { "keyword": impact, ... }
+			if (m_inSentimentObject && m_depth == 2 && !m_keyword.empty())
+			{
+				m_sentiment.emplace_back(m_keyword, static_cast<float>(value));
+			}
+			return Default();
+		}
+		bool Default() { m_newsKeyPending = false; m_sentimentKeyPending = false; return true; }
+
+		std::vector<News>& m_news;
+		std::vector<std::pair<std::string, float>>& m_sentiment;
+		std::string m_keyword;
+		int m_depth = 0;
+		bool m_newsKeyPending = false;
+		bool m_sentimentKeyPending = false;
+		bool m_inNewsArray = false;
+		bool m_inSentimentObject = false;
+	};
+}
+
 /// @brief Load market news from JSON file
-/// Parses news.json, shuffles items randomly, and resets news index
+/// Reads news.json into one arena buffer and indexes the headlines in place
 /// @param path Full path to the JSON file to load
 void StockMarket::LoadJsonNews(const std::string& path)
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Loaders, "LoadJsonNews");
+	STARTUP_PHASE("LoadJsonNews");
+	MetricTimerScope loadTimer(MetricHistogram::DataLoadSeconds);
 	DebugLog("Loading News from: " + path);
-	std::ifstream stream(path);
-	std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	m_newsArena.clear();
+	m_news.clear();
+	m_newsTags.clear();
+	m_newsSentiment.clear();
+	m_newsIndex = 0;
 
-	Json::Document document;
-	document.Parse(fileData.c_str());
-	assert(!document.HasParseError());
+	StartupAssetScope asset(path, StartupAssetKind::Json);
+	std::ifstream stream(path, std::ios::binary | std::ios::ate);
+	if (!stream.is_open())
+	{
+		asset.Complete(false);
+		DebugLog("Failed to open file: " + path, DebugType::Error);
+		return;
+	}
 
-	assert(document.IsObject());
+	// Single allocation for the whole corpus, null-terminated for in-situ parsing
+	std::streamsize fileSize = stream.tellg();
+	stream.seekg(0, std::ios::beg);
+	m_newsArena.resize(static_cast<size_t>(fileSize) + 1);
+	stream.read(m_newsArena.data(), fileSize);
+	m_newsArena[static_cast<size_t>(fileSize)] = '\0';
+	asset.MarkRead(static_cast<uint64_t>(fileSize));
+
+	NewsCollector collector(m_news, m_newsSentiment);
+	Json::Reader reader;
+	Json::InsituStringStream insituStream(m_newsArena.data());
+	Json::ParseResult result = reader.Parse<Json::kParseInsituFlag>(insituStream, collector);
+	asset.Complete(!result.IsError());
+	if (result.IsError())
+	{
+		DebugLog("JSON Parse Error: " + std::string(Json::GetParseError_En(result.Code())) + " at offset " + std::to_string(result.Offset()), DebugType::Error);
+		m_news.clear();
+		m_newsArena.clear();
+		return;
+	}
 
-	//news
-	assert(document.HasMember("news"));
-	const Json::Value& arrayObject = document["news"];
-	assert(arrayObject.IsArray());
-	for (Json::SizeType i = 0; i < arrayObject.Size(); i++)
+	DebugLog("Loaded " + std::to_string(m_news.size()) + " news items (" + std::to_string(m_newsArena.size()) + " bytes)");
+
+	TagNewsWithMarketEvents();
+}
+
+/// @brief Tag every headline with the products it mentions and its sentiment
+/// Builds one Aho-Corasick automaton from product names, company names and the
+/// sentiment keywords of news.json, then scans each headline once, so tagging
+/// stays linear in the corpus size
+void StockMarket::TagNewsWithMarketEvents()
+{
+	MEMORY_TAG_SCOPE(MemoryTag::Loaders, "TagNewsWithMarketEvents");
+	STARTUP_PHASE("TagNewsWithMarketEvents");
+	m_newsTags.clear();
+
+	// Pattern ids: [0, productCount) are products, the rest index m_newsSentiment
+	const uint32_t productCount = static_cast<uint32_t>(m_stockProducts.size());
+
+	// One lookup per product; GetStockVendorByProductId would make this quadratic in large catalogs
+	std::unordered_map<std::string, const StockVendor*> vendorsByProductId;
+	vendorsByProductId.reserve(m_stockVendors.size());
+	for (const StockVendor& vendor : m_stockVendors)
 	{
-		News newNews;
+		vendorsByProductId.emplace(vendor.m_productId, &vendor);
+	}
 
-		// newsContent
-		assert(arrayObject[i].IsString());
-		newNews.m_newsContent = arrayObject[i].GetString();
+	KeywordMatcher matcher;
+	for (uint32_t i = 0; i < productCount; i++)
+	{
+		const StockProduct& product = m_stockProducts[i];
+		std::vector<std::string> aliases;
+
+		// Product name and its first word ("Tritanium Ore" -> "Tritanium")
+		aliases.push_back(product.m_name);
+		aliases.push_back(product.m_name.substr(0, product.m_name.find(' ')));
+
+		// Company name and its short form ("Flux Neural Systems" -> "Flux Neural")
+		auto vendorIt = vendorsByProductId.find(product.m_id);
+		if (vendorIt != vendorsByProductId.end())
+		{
+			const StockVendor* vendor = vendorIt->second;
+			aliases.push_back(vendor->m_company);
+			size_t lastSpace = vendor->m_company.find_last_of(' ');
+			if (lastSpace != std::string::npos)
+			{
+				aliases.push_back(vendor->m_company.substr(0, lastSpace));
+			}
+		}
 
-		m_news.push_back(std::move(newNews));
+		for (const std::string& alias : aliases)
+		{
+			matcher.AddPattern(alias, i, true);
+		}
 	}
+	for (uint32_t i = 0; i < m_newsSentiment.size(); i++)
+	{
+		// A trailing '*' marks a stem: "climb*" also matches "climbs" and "climbing"
+		std::string keyword = m_newsSentiment[i].first;
+		bool isStem = !keyword.empty() && keyword.back() == '*';
+		if (isStem)
+		{
+			keyword.pop_back();
+		}
+		matcher.AddPattern(keyword, productCount + i, !isStem);
+	}
+	matcher.Build();
 
-	// Shuffle the news items randomly
-	std::shuffle(m_news.begin(), m_news.end(), Application::GetRandomGenerator());
+	std::vector<KeywordMatcher::Match> matches;
+	uint32_t taggedNews = 0;
+	for (News& news : m_news)
+	{
+		matcher.FindAll(news.m_newsContent, news.m_newsLength, matches);
 
-	// Reset news index to 0
-	m_newsIndex = 0;
+		float impact = 0.0f;
+		news.m_tagOffset = static_cast<uint32_t>(m_newsTags.size());
+		for (const KeywordMatcher::Match& match : matches)
+		{
+			if (match.m_patternId >= productCount)
+			{
+				impact += m_newsSentiment[match.m_patternId - productCount].second;
+			}
+			else if (std::find(m_newsTags.begin() + news.m_tagOffset, m_newsTags.end(), match.m_patternId) == m_newsTags.end())
+			{
+				m_newsTags.push_back(match.m_patternId);
+			}
+		}
+		news.m_tagCount = static_cast<uint32_t>(m_newsTags.size()) - news.m_tagOffset;
+		news.m_impact = std::max(-s_maxNewsImpact, std::min(s_maxNewsImpact, impact));
+
+		if (news.m_tagCount > 0 && news.m_impact != 0.0f)
+		{
+			taggedNews++;
+		}
+	}
 
-	DebugLog("Loaded and shuffled " + std::to_string(m_news.size()) + " news items");
+	DebugLog("Tagged " + std::to_string(taggedNews) + " of " + std::to_string(m_news.size()) + " news items as market events (" +
+		std::to_string(matcher.GetPatternCount()) + " keywords, " + std::to_string(matcher.GetStateCount()) + " states)");
 }
 
-/// @brief Get the next news item in cyclical rotation
-/// When all news have been shown, reshuffles and starts over
+/// @brief Get the next news item in random rotation
+/// Uses an incremental Fisher-Yates shuffle over the headline index: each call swaps one
+/// random remaining headline into place, so every headline is shown once per pass and no
+/// call ever touches the whole corpus
 /// @return Pointer to next news item, nullptr if no news loaded
 News* StockMarket::GetNextNews()
 {
+	MEMORY_TAG_SCOPE(MemoryTag::Market, "GetNextNews");
 	// Safety check: ensure we have news loaded
 	if (m_news.empty())
 	{
@@ -931,29 +1364,31 @@ News* StockMarket::GetNextNews()
 		return nullptr;
 	}
 
-	// Safety check: ensure index is valid before array access
+	// Start a new pass when every headline has been shown
 	if (m_newsIndex >= m_news.size())
 	{
 		m_newsIndex = 0;
-		DebugLog("GetNextNews - Index was out of bounds, reset to 0");
 	}
 
-	// Get the current news item (safe now)
-	News* currentNews = &m_news[m_newsIndex];
-
-	// Debug log before incrementing
-	DebugLog("GetNextNews - Returning news at index " + std::to_string(m_newsIndex));
+	// Pick one of the headlines not yet shown in this pass
+	std::uniform_int_distribution<size_t> pick(m_newsIndex, m_news.size() - 1);
+	std::swap(m_news[m_newsIndex], m_news[pick(Application::GetRandomGenerator())]);
 
-	// Increment the index for next call
+	News* currentNews = &m_news[m_newsIndex];
 	m_newsIndex++;
 
-	// Check if next index would overflow, reset and shuffle if so
-	if (m_newsIndex >= m_news.size())
+	// A headline on the ticker moves the prices of the products it mentions this cycle
+	if (currentNews->m_impact != 0.0f)
 	{
-		m_newsIndex = 0;
-		// Shuffle the news items randomly
-		std::shuffle(m_news.begin(), m_news.end(), Application::GetRandomGenerator());
-		DebugLog("GetNextNews - Reached end of news, reset to 0 and reshuffled for next call");
+		for (uint32_t i = 0; i < currentNews->m_tagCount; i++)
+		{
+			StockProduct& product = m_stockProducts[m_newsTags[currentNews->m_tagOffset + i]];
+			product.m_newsImpact = std::max(-s_maxNewsImpact, std::min(s_maxNewsImpact, product.m_newsImpact + currentNews->m_impact));
+			if (IsDebugLogEnabled(DebugType::Verbose))
+			{
+				DebugLog("News impact - " + product.m_id + ": " + std::to_string(currentNews->m_impact), DebugType::Verbose);
+			}
+		}
 	}
 
 	return currentNews;
@@ -966,3 +1401,45 @@ void StockMarket::SetCurrentProductID(const std::string& productId)
 	currentProductID = productId;
 	DebugLog("StockMarket - Current product ID set to: " + productId);
 }
+
+/// @brief Hash of the simulation state that input playback must reproduce
+/// @return FNV-1a hash over the market counters, every product's runtime values and the player's money and holdings
+/// Floats are hashed bitwise: a playback of the same build and data must match exactly
+uint64_t StockMarket::ComputeStateChecksum() const
+{
+	uint64_t hash = 14695981039346656037ull;
+	auto mix = [&hash](const void* data, size_t size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash = (hash ^ bytes[i]) * 1099511628211ull;
+		}
+	};
+
+	mix(&m_cycleCount, sizeof(m_cycleCount));
+	mix(&m_tradeCount, sizeof(m_tradeCount));
+	mix(&m_currentCycleTime, sizeof(m_currentCycleTime));
+	mix(&m_newsIndex, sizeof(m_newsIndex));
+	for (const StockProduct& product : m_stockProducts)
+	{
+		mix(&product.m_quantity, sizeof(product.m_quantity));
+		mix(&product.m_trendPointer, sizeof(product.m_trendPointer));
+		mix(&product.m_currentPrice, sizeof(product.m_currentPrice));
+		mix(&product.m_currentPriceWithoutPlayerImpact, sizeof(product.m_currentPriceWithoutPlayerImpact));
+		mix(&product.m_currentPlayerImpact, sizeof(product.m_currentPlayerImpact));
+		mix(&product.m_newsImpact, sizeof(product.m_newsImpact));
+	}
+
+	const Inventory* inventory = m_application ? m_application->GetPlayerInventory() : nullptr;
+	if (inventory)
+	{
+		uint32_t money = inventory->GetCurrentMoney();
+		mix(&money, sizeof(money));
+		for (const StockProduct& product : inventory->GetPlayerProducts())
+		{
+			mix(&product.m_quantity, sizeof(product.m_quantity));
+		}
+	}
+	return hash;
+}
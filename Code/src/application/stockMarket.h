@@ -1,6 +1,9 @@
 #pragma once
 #include "pch.h"
 #include "inventory.h"
+#include "dataWatcher.h"
+#include "modelChangeBus.h"
+#include <mutex>
 
 struct Personality
 {
@@ -29,10 +32,24 @@ struct StockVendor final
 	Personality m_personality;                  ///< Personality traits
 };
 
+/// View of one headline inside the news arena (the in-situ parsed news.json buffer)
 struct News final
 {
-	std::string m_newsContent;      ///< The news text content
-	uint32_t m_currentNewsIndex;    ///< Current index (not used in practice)
+	const char* m_newsContent;      ///< Null-terminated headline text, owned by the news arena
+	uint32_t m_newsLength;          ///< Headline length in bytes
+	uint32_t m_currentNewsIndex;    ///< Position of the headline in news.json
+	float m_impact;                 ///< Signed price impact from sentiment keywords
+	uint32_t m_tagOffset;           ///< First affected product in StockMarket::m_newsTags
+	uint32_t m_tagCount;            ///< Number of affected products
+};
+
+/// Parsed content of item_products.json. Produced without logging so it can be built
+/// on the data watcher thread; messages are logged when the catalog is applied.
+struct StockProductCatalog final
+{
+	std::vector<StockProduct> m_products;    ///< Product definitions in file order
+	std::vector<std::string> m_warnings;     ///< Non-fatal issues found while parsing
+	std::string m_error;                     ///< Empty on success
 };
 
 class Application; // forward declaration
@@ -43,6 +60,7 @@ public:
 	// === Core System Functions ===
 	void InitializeStockMarket(Application* app);
 	void StockMarketUpdate(sf::Time delta);
+	void RunMarketCycle();
 	void StockMarketCycleStep();
 	void CycleTimerUpdate();
 
@@ -51,6 +69,12 @@ public:
 	void LoadJsonStockVendors(const std::string& path);
 	void LoadJsonNews(const std::string& path);
 	News* GetNextNews();
+	void TagNewsWithMarketEvents();
+	static StockProductCatalog ParseJsonStockProducts(const std::string& path);
+
+	// === Data Hot Reload ===
+	void StartDataHotReload();
+	void ApplyPendingDataReload();
 
 	// === Product Management Functions ===
 	void InitializeProductValues();
@@ -61,6 +85,7 @@ public:
 
 	// === Product Access Functions ===
 	StockProduct* GetStockProductById(const std::string& productId);
+	int32_t GetStockProductIndex(const std::string& productId) const;
 	bool ValidateBuyFromStock(const std::string& productId, uint32_t desiredQuantity);
 	bool ValidateSellForStock(const std::string& productId, uint32_t desiredQuantity);
 	bool BuyFromStock(const std::string& productId, uint32_t quantity);
@@ -72,22 +97,42 @@ public:
 	// === Current Product Management ===
 	void SetCurrentProductID(const std::string& productId);
 
+	// === Determinism Checks ===
+	uint64_t ComputeStateChecksum() const;
+
 	// === Public State Variables ===
 	float m_currentCycleTime = 0.0f;    	///< Current time within market cycle (seconds)
 	uint32_t m_cycleCount = 0;           	///< Total number of completed market cycles
+	uint32_t m_tradeCount = 0;           	///< Total number of executed buy and sell transactions
 	std::string currentProductID;        	///< Currently selected product ID
+	bool m_dataHotReload = true;         	///< InitializeStockMarket watches the data folder for edits (off in tools)
 
 private:
 	// === System References ===
 	Application* m_application = nullptr;       ///< Reference to main application instance
+	ModelChangeBus* m_changeBus = nullptr;      ///< Receives the fields changed for the UI
+
+	void MarkProductChanges(const StockProduct& product, uint32_t oldQuantity, uint32_t oldPrice, bool oldTrendIncreased);
+	uint32_t GetProductIndex(const StockProduct& product) const { return static_cast<uint32_t>(&product - m_stockProducts.data()); }
 
 	// === Core Data Collections ===
 	std::vector<StockProduct> m_stockProducts;  ///< All available stock products
 	std::vector<StockVendor> m_stockVendors;    ///< All vendor characters
-	std::vector<News> m_news;                   ///< All market news items
-	uint32_t m_newsIndex = 0;                   ///< Current news index for rotation
+	std::vector<char> m_newsArena;              ///< news.json contents, strings decoded in place
+	std::vector<News> m_news;                   ///< Headline index into m_newsArena, permuted during rotation
+	uint32_t m_newsIndex = 0;                   ///< Next position of the incremental shuffle
+	std::vector<uint32_t> m_newsTags;           ///< Product indices affected by each headline (see News::m_tagOffset)
+	std::vector<std::pair<std::string, float>> m_newsSentiment; ///< Sentiment keywords and their price impact from news.json
+
+	// === Data Hot Reload ===
+	void OnDataFileChanged(const std::string& fileName);
+
+	std::mutex m_pendingReloadMutex;                              ///< Guards m_pendingProductCatalog
+	std::unique_ptr<StockProductCatalog> m_pendingProductCatalog; ///< Parsed catalog waiting for the next cycle boundary
+	DataWatcher m_dataWatcher;                                    ///< Declared last so its thread stops first
 
 	// === Market Constants ===
 	static constexpr float s_randomPriceInfluenceFactor = 0.015f;  ///< Max random price variation (±2.5%)
 	static constexpr float s_stockCycleTime = 5.0f;                ///< Time between market cycles (seconds)
+	static constexpr float s_maxNewsImpact = 0.1f;                 ///< Max price change from one headline (±10%)
 };
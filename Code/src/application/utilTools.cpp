@@ -2,11 +2,24 @@
 #include "utilTools.h"
 
 #include <iostream>
+#ifdef _WIN32
 #include <Windows.h>
+#include <Psapi.h>
+#else
+#include <sys/resource.h>
+#endif
 
+static DebugType s_debugLogLevel = DebugType::Message;
 
 void DebugLog(const std::string& message, DebugType type)
 {
+	if (type < s_debugLogLevel)
+	{
+		return;
+	}
+	MEMORY_TAG_SCOPE(MemoryTag::Logging, "DebugLog");
+	Metrics::Get().Add(type == Error ? MetricCounter::LogErrors : type == Warning ? MetricCounter::LogWarnings : MetricCounter::LogMessages);
+
 #ifdef _WIN32
 	// Optional color (green) for readability; reset after printing.
 	WORD color;
@@ -39,6 +52,16 @@ void DebugLog(const std::string& message, DebugType type)
 #endif
 }
 
+void SetDebugLogLevel(DebugType minimumType)
+{
+	s_debugLogLevel = minimumType;
+}
+
+bool IsDebugLogEnabled(DebugType type)
+{
+	return type >= s_debugLogLevel;
+}
+
 std::string GetExecutableDirectory()
 {
 #ifdef _WIN32
@@ -57,3 +80,26 @@ std::string GetExecutableDirectory()
 	// Fallback to current directory
 	return "./";
 }
+
+size_t GetPeakMemoryBytes()
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return counters.PeakWorkingSetSize;
+	}
+#else
+	// Peak resident set size; Linux reports it in kilobytes, macOS in bytes
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+	{
+#ifdef __APPLE__
+		return static_cast<size_t>(usage.ru_maxrss);
+#else
+		return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+	}
+#endif
+	return 0;
+}
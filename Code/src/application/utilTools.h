@@ -2,10 +2,14 @@
 
 enum DebugType
 {
+	Verbose,    // Per product or per item detail, dropped unless the log level is lowered
 	Message,
 	Warning,
 	Error,
 };
 
 void DebugLog(const std::string& message, DebugType type = DebugType::Message);
+void SetDebugLogLevel(DebugType minimumType); // Messages below this type are dropped (default: Message)
+bool IsDebugLogEnabled(DebugType type); // Check before building an expensive message
 std::string GetExecutableDirectory();
+size_t GetPeakMemoryBytes(); // Peak working set (resident set on POSIX) of the process, 0 if it could not be queried
@@ -0,0 +1,287 @@
+#include "pch.h"
+#include "memoryTracker.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+constexpr size_t MemoryTracker::s_maxSites;
+constexpr uint16_t MemoryTracker::s_untaggedSite;
+constexpr uint32_t MemoryTracker::s_assertWarmupFrames;
+
+namespace
+{
+  // Placed in front of every block so Free knows what to give back; 16 bytes keep the
+  // alignment malloc guarantees
+  struct alignas(16) AllocationHeader
+  {
+    size_t m_size;
+    MemoryTag m_tag;
+  };
+
+  // No constructors, so this is zero-initialized and usable from the first allocation on
+  MemoryTracker s_tracker;
+
+  // State of the allocating thread; trivial types only so no TLS initializer ever allocates
+  thread_local MemoryTag s_currentTag;
+  thread_local uint16_t s_currentSite;
+  thread_local uint32_t s_noAllocDepth;
+  thread_local uint64_t s_threadAllocations;
+  thread_local uint16_t s_violationSite;
+  thread_local bool s_violationPending;
+
+  const char* s_tagNames[] = { "untagged", "market", "inventory", "ui", "loaders", "logging" };
+  static_assert(sizeof(s_tagNames) / sizeof(s_tagNames[0]) == static_cast<size_t>(MemoryTag::MAX), "Missing memory tag name");
+
+  size_t HashSiteName(const char* name)
+  {
+    return static_cast<size_t>((reinterpret_cast<uintptr_t>(name) >> 3) * 2654435761u);
+  }
+}
+
+MemoryTracker& MemoryTracker::Get()
+{
+  return s_tracker;
+}
+
+const char* MemoryTracker::GetTagName(MemoryTag tag)
+{
+  return tag < MemoryTag::MAX ? s_tagNames[static_cast<int>(tag)] : "unknown";
+}
+
+void MemoryTracker::EndFrame()
+{
+  uint64_t frameAllocations = 0;
+  for (int tag = 0; tag < static_cast<int>(MemoryTag::MAX); ++tag)
+  {
+    uint64_t allocations = m_frameAllocations[tag].exchange(0, std::memory_order_relaxed);
+    m_lastFrameAllocations[tag].store(allocations, std::memory_order_relaxed);
+    m_lastFrameBytes[tag].store(m_frameBytes[tag].exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    frameAllocations += allocations;
+  }
+  m_frameCount.fetch_add(1, std::memory_order_relaxed);
+
+  // One sample per frame, so allocation spikes line up with the frames in a trace capture
+  TRACE_COUNTER("Allocations", frameAllocations);
+}
+
+MemoryTracker::TagStats MemoryTracker::GetTagStats(MemoryTag tag) const
+{
+  int index = static_cast<int>(tag);
+  TagStats stats;
+  stats.m_frameAllocations = m_lastFrameAllocations[index].load(std::memory_order_relaxed);
+  stats.m_frameBytes = m_lastFrameBytes[index].load(std::memory_order_relaxed);
+  stats.m_liveAllocations = m_liveAllocations[index].load(std::memory_order_relaxed);
+  stats.m_liveBytes = m_liveBytes[index].load(std::memory_order_relaxed);
+  return stats;
+}
+
+MemoryTracker::TagStats MemoryTracker::GetTotalStats() const
+{
+  TagStats total = {};
+  for (int tag = 0; tag < static_cast<int>(MemoryTag::MAX); ++tag)
+  {
+    TagStats stats = GetTagStats(static_cast<MemoryTag>(tag));
+    total.m_frameAllocations += stats.m_frameAllocations;
+    total.m_frameBytes += stats.m_frameBytes;
+    total.m_liveAllocations += stats.m_liveAllocations;
+    total.m_liveBytes += stats.m_liveBytes;
+  }
+  return total;
+}
+
+void MemoryTracker::GetTopSites(std::vector<SiteStats>& sites, size_t count) const
+{
+  sites.clear();
+  for (size_t i = 0; i < s_maxSites; ++i)
+  {
+    const Site& site = m_sites[i];
+    uint64_t allocations = site.m_allocations.load(std::memory_order_relaxed);
+    if (allocations == 0)
+    {
+      continue;
+    }
+
+    SiteStats stats;
+    stats.m_name = site.m_name.load(std::memory_order_acquire);
+    stats.m_tag = static_cast<MemoryTag>(site.m_tag.load(std::memory_order_relaxed));
+    stats.m_allocations = allocations;
+    stats.m_bytes = site.m_bytes.load(std::memory_order_relaxed);
+    sites.push_back(stats);
+  }
+
+  std::sort(sites.begin(), sites.end(), [](const SiteStats& a, const SiteStats& b)
+  {
+    return a.m_allocations > b.m_allocations;
+  });
+  if (sites.size() > count)
+  {
+    sites.resize(count);
+  }
+}
+
+void MemoryTracker::WriteReport(std::ostream& stream, size_t siteCount) const
+{
+  stream << "Memory (last frame / live)\n";
+  stream << std::left << std::setw(12) << "tag" << std::right
+    << std::setw(10) << "allocs" << std::setw(12) << "bytes"
+    << std::setw(12) << "live" << std::setw(14) << "live bytes" << '\n';
+
+  auto writeRow = [&stream](const char* name, const TagStats& stats)
+  {
+    stream << std::left << std::setw(12) << name << std::right
+      << std::setw(10) << stats.m_frameAllocations << std::setw(12) << stats.m_frameBytes
+      << std::setw(12) << stats.m_liveAllocations << std::setw(14) << stats.m_liveBytes << '\n';
+  };
+  for (int tag = 0; tag < static_cast<int>(MemoryTag::MAX); ++tag)
+  {
+    writeRow(GetTagName(static_cast<MemoryTag>(tag)), GetTagStats(static_cast<MemoryTag>(tag)));
+  }
+  writeRow("total", GetTotalStats());
+
+  std::vector<SiteStats> sites;
+  GetTopSites(sites, siteCount);
+  stream << "Top allocating sites (since start)\n";
+  for (const SiteStats& site : sites)
+  {
+    stream << std::setw(10) << site.m_allocations << std::setw(14) << site.m_bytes << "  "
+      << (site.m_name ? site.m_name : "(untagged)") << " [" << GetTagName(site.m_tag) << "]\n";
+  }
+
+  uint64_t violations = GetNoAllocViolations();
+  if (violations > 0)
+  {
+    const char* scope = m_lastViolationScope.load(std::memory_order_relaxed);
+    const char* site = m_sites[m_lastViolationSite.load(std::memory_order_relaxed)].m_name.load(std::memory_order_acquire);
+    stream << "No-alloc violations: " << violations << " (last in " << (scope ? scope : "?")
+      << ", charged to " << (site ? site : "(untagged)") << ")\n";
+  }
+}
+
+void* MemoryTracker::Allocate(size_t size)
+{
+  if (size > SIZE_MAX - sizeof(AllocationHeader))
+  {
+    return nullptr;
+  }
+  AllocationHeader* header = static_cast<AllocationHeader*>(std::malloc(size + sizeof(AllocationHeader)));
+  if (!header)
+  {
+    return nullptr;
+  }
+
+  MemoryTag tag = s_currentTag;
+  int tagIndex = static_cast<int>(tag);
+  header->m_size = size;
+  header->m_tag = tag;
+
+  m_frameAllocations[tagIndex].fetch_add(1, std::memory_order_relaxed);
+  m_frameBytes[tagIndex].fetch_add(size, std::memory_order_relaxed);
+  m_liveAllocations[tagIndex].fetch_add(1, std::memory_order_relaxed);
+  m_liveBytes[tagIndex].fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+
+  Site& site = m_sites[s_currentSite];
+  site.m_allocations.fetch_add(1, std::memory_order_relaxed);
+  site.m_bytes.fetch_add(size, std::memory_order_relaxed);
+
+  ++s_threadAllocations;
+  if (s_noAllocDepth > 0 && !s_violationPending)
+  {
+    s_violationSite = s_currentSite;
+    s_violationPending = true;
+  }
+  return header + 1;
+}
+
+void MemoryTracker::Free(void* memory)
+{
+  if (!memory)
+  {
+    return;
+  }
+
+  AllocationHeader* header = static_cast<AllocationHeader*>(memory) - 1;
+  int tagIndex = static_cast<int>(header->m_tag);
+  m_liveAllocations[tagIndex].fetch_sub(1, std::memory_order_relaxed);
+  m_liveBytes[tagIndex].fetch_sub(static_cast<int64_t>(header->m_size), std::memory_order_relaxed);
+  std::free(header);
+}
+
+uint16_t MemoryTracker::RegisterSite(const char* name, MemoryTag tag)
+{
+  // Open addressing on the literal's address; slot 0 stays reserved for untagged allocations
+  size_t start = HashSiteName(name) % (s_maxSites - 1);
+  for (size_t probe = 0; probe < s_maxSites - 1; ++probe)
+  {
+    size_t index = 1 + (start + probe) % (s_maxSites - 1);
+    Site& site = m_sites[index];
+    const char* current = site.m_name.load(std::memory_order_acquire);
+    if (current == name)
+    {
+      return static_cast<uint16_t>(index);
+    }
+    if (!current)
+    {
+      site.m_tag.store(static_cast<uint8_t>(tag), std::memory_order_relaxed);
+      if (site.m_name.compare_exchange_strong(current, name, std::memory_order_acq_rel) || current == name)
+      {
+        return static_cast<uint16_t>(index);
+      }
+    }
+  }
+  return s_untaggedSite;
+}
+
+void MemoryTracker::ReportNoAllocViolation(const char* scopeName, uint64_t allocations, uint16_t site)
+{
+  m_noAllocViolations.fetch_add(1, std::memory_order_relaxed);
+  m_lastViolationScope.store(scopeName, std::memory_order_relaxed);
+  m_lastViolationSite.store(site, std::memory_order_relaxed);
+
+  if (IsAssertingNoAlloc())
+  {
+    const char* siteName = m_sites[site].m_name.load(std::memory_order_acquire);
+    std::cerr << "No-alloc scope '" << scopeName << "' allocated " << allocations << " time(s), first charged to "
+      << (siteName ? siteName : "(untagged)") << std::endl;
+    assert(false && "Allocation inside a MEMORY_NO_ALLOC_SCOPE");
+  }
+}
+
+MemoryTagScope::MemoryTagScope(MemoryTag tag, const char* site)
+  : m_previousTag(s_currentTag)
+  , m_previousSite(s_currentSite)
+{
+  s_currentTag = tag;
+  s_currentSite = MemoryTracker::Get().RegisterSite(site, tag);
+}
+
+MemoryTagScope::~MemoryTagScope()
+{
+  s_currentTag = m_previousTag;
+  s_currentSite = m_previousSite;
+}
+
+NoAllocScope::NoAllocScope(const char* name)
+  : m_name(name)
+  , m_allocationsAtStart(s_threadAllocations)
+{
+  ++s_noAllocDepth;
+}
+
+NoAllocScope::~NoAllocScope()
+{
+  --s_noAllocDepth;
+  uint64_t allocations = s_threadAllocations - m_allocationsAtStart;
+  if (allocations == 0)
+  {
+    return;
+  }
+
+  uint16_t site = s_violationSite;
+  s_violationPending = false;
+  MemoryTracker& tracker = MemoryTracker::Get();
+  if (tracker.GetFrameCount() >= MemoryTracker::s_assertWarmupFrames)
+  {
+    tracker.ReportNoAllocViolation(m_name, allocations, site);
+  }
+}
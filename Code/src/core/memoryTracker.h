@@ -0,0 +1,146 @@
+#pragma once
+#include "traceRecorder.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+// Opt-in heap accounting. With MEMORY_TRACKING_ENABLED the executable replaces the global
+// operator new/delete (application/memoryHooks.cpp) and every allocation is counted against the
+// subsystem tag and call site of the innermost MEMORY_TAG_SCOPE on the allocating thread.
+// On by default in Debug builds; define MEMORY_TRACKING_ENABLED=0 or 1 to override.
+#ifndef MEMORY_TRACKING_ENABLED
+#ifdef _DEBUG
+#define MEMORY_TRACKING_ENABLED 1
+#else
+#define MEMORY_TRACKING_ENABLED 0
+#endif
+#endif
+
+// Subsystem an allocation is charged to
+enum class MemoryTag : uint8_t
+{
+  Untagged,
+  Market,
+  Inventory,
+  UI,
+  Loaders,
+  Logging,
+  MAX
+};
+
+class MemoryTracker
+{
+public:
+  static constexpr size_t s_maxSites = 256;
+  static constexpr uint16_t s_untaggedSite = 0;
+  static constexpr uint32_t s_assertWarmupFrames = 120; // Caches fill in the first frames (glyphs, profiler nodes)
+
+  struct TagStats
+  {
+    uint64_t m_frameAllocations;  // In the last finished frame
+    uint64_t m_frameBytes;
+    int64_t m_liveAllocations;
+    int64_t m_liveBytes;
+  };
+
+  struct SiteStats
+  {
+    const char* m_name;        // As passed to MEMORY_TAG_SCOPE, nullptr for untagged allocations
+    MemoryTag m_tag;
+    uint64_t m_allocations;    // Since start
+    uint64_t m_bytes;
+  };
+
+  static MemoryTracker& Get();
+  static bool IsEnabled() { return MEMORY_TRACKING_ENABLED != 0; }
+  static const char* GetTagName(MemoryTag tag);
+
+  // Closes the running frame and samples its allocation count into a running trace capture;
+  // called once per iteration of the main loop
+  void EndFrame();
+  uint32_t GetFrameCount() const { return m_frameCount.load(std::memory_order_relaxed); }
+
+  TagStats GetTagStats(MemoryTag tag) const;
+  TagStats GetTotalStats() const;
+  void GetTopSites(std::vector<SiteStats>& sites, size_t count) const; // Most allocations first
+  void WriteReport(std::ostream& stream, size_t siteCount) const;
+
+  // Allocations inside a MEMORY_NO_ALLOC_SCOPE after the warm-up frames are counted as
+  // violations; in assertion mode (--assert-no-alloc) they also assert.
+  void SetAssertNoAlloc(bool enabled) { m_assertNoAlloc.store(enabled, std::memory_order_relaxed); }
+  bool IsAssertingNoAlloc() const { return m_assertNoAlloc.load(std::memory_order_relaxed); }
+  uint64_t GetNoAllocViolations() const { return m_noAllocViolations.load(std::memory_order_relaxed); }
+
+  // Called by the global operator new/delete; Allocate returns nullptr when out of memory
+  void* Allocate(size_t size);
+  void Free(void* memory);
+
+  // Called by the scopes; returns s_untaggedSite when the site table is full
+  uint16_t RegisterSite(const char* name, MemoryTag tag);
+  void ReportNoAllocViolation(const char* scopeName, uint64_t allocations, uint16_t site);
+
+private:
+  struct Site
+  {
+    std::atomic<const char*> m_name;
+    std::atomic<uint8_t> m_tag;
+    std::atomic<uint64_t> m_allocations;
+    std::atomic<uint64_t> m_bytes;
+  };
+
+  // Plain atomics only: the tracker is zero-initialized before any constructor runs, so
+  // allocations made during static initialization are counted too
+  std::atomic<uint64_t> m_frameAllocations[static_cast<int>(MemoryTag::MAX)];
+  std::atomic<uint64_t> m_frameBytes[static_cast<int>(MemoryTag::MAX)];
+  std::atomic<uint64_t> m_lastFrameAllocations[static_cast<int>(MemoryTag::MAX)];
+  std::atomic<uint64_t> m_lastFrameBytes[static_cast<int>(MemoryTag::MAX)];
+  std::atomic<int64_t> m_liveAllocations[static_cast<int>(MemoryTag::MAX)];
+  std::atomic<int64_t> m_liveBytes[static_cast<int>(MemoryTag::MAX)];
+  Site m_sites[s_maxSites];
+
+  std::atomic<uint32_t> m_frameCount;
+  std::atomic<bool> m_assertNoAlloc;
+  std::atomic<uint64_t> m_noAllocViolations;
+  std::atomic<const char*> m_lastViolationScope;
+  std::atomic<uint16_t> m_lastViolationSite;
+};
+
+// Charges the allocations of the enclosing block to a subsystem and call site (string literal)
+class MemoryTagScope
+{
+public:
+  MemoryTagScope(MemoryTag tag, const char* site);
+  ~MemoryTagScope();
+  MemoryTagScope(const MemoryTagScope&) = delete;
+  MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+  MemoryTag m_previousTag;
+  uint16_t m_previousSite;
+};
+
+// Marks a hot path that must not allocate
+class NoAllocScope
+{
+public:
+  explicit NoAllocScope(const char* name);
+  ~NoAllocScope();
+  NoAllocScope(const NoAllocScope&) = delete;
+  NoAllocScope& operator=(const NoAllocScope&) = delete;
+
+private:
+  const char* m_name;
+  uint64_t m_allocationsAtStart;
+};
+
+#if MEMORY_TRACKING_ENABLED
+#define MEMORY_TAG_SCOPE(tag, site) MemoryTagScope PROFILE_CONCAT(memoryTagScope, __LINE__)(tag, site)
+#define MEMORY_NO_ALLOC_SCOPE(name) NoAllocScope PROFILE_CONCAT(noAllocScope, __LINE__)(name)
+#define MEMORY_END_FRAME() MemoryTracker::Get().EndFrame()
+#else
+#define MEMORY_TAG_SCOPE(tag, site) ((void)0)
+#define MEMORY_NO_ALLOC_SCOPE(name) ((void)0)
+#define MEMORY_END_FRAME() ((void)0)
+#endif
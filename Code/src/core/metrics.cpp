@@ -0,0 +1,186 @@
+#include "pch.h"
+#include "metrics.h"
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+
+constexpr size_t Metrics::s_maxBuckets;
+
+namespace
+{
+  // No constructors, so this is zero-initialized before any code runs
+  Metrics s_metrics;
+
+  struct Family
+  {
+    const char* m_name;
+    const char* m_help;
+    const char* m_labels;   // Appended inside {}, nullptr for none
+  };
+
+  // Counters sharing a name are written as one family with different labels
+  const Family s_counterFamilies[] = {
+    { "hytr_frames_total", "Frames run by the main loop", nullptr },
+    { "hytr_market_cycles_total", "Market cycles executed", nullptr },
+    { "hytr_trades_total", "Buy and sell transactions executed", nullptr },
+    { "hytr_log_messages_total", "Messages written by DebugLog", "level=\"message\"" },
+    { "hytr_log_messages_total", "Messages written by DebugLog", "level=\"warning\"" },
+    { "hytr_log_messages_total", "Messages written by DebugLog", "level=\"error\"" },
+    { "hytr_texture_decodes_total", "Image files decoded by the texture cache worker", "result=\"ok\"" },
+    { "hytr_texture_decodes_total", "Image files decoded by the texture cache worker", "result=\"failed\"" },
+  };
+  static_assert(sizeof(s_counterFamilies) / sizeof(s_counterFamilies[0]) == static_cast<size_t>(MetricCounter::MAX), "Missing counter family");
+
+  const Family s_gaugeFamilies[] = {
+    { "hytr_texture_resident_bytes", "Memory held by decoded and uploaded textures", nullptr },
+    { "hytr_texture_decode_queue_depth", "Image files waiting for or in decoding", nullptr },
+  };
+  static_assert(sizeof(s_gaugeFamilies) / sizeof(s_gaugeFamilies[0]) == static_cast<size_t>(MetricGauge::MAX), "Missing gauge family");
+
+  const Family s_histogramFamilies[] = {
+    { "hytr_frame_seconds", "Real time of a main loop iteration", nullptr },
+    { "hytr_texture_decode_seconds", "Time to decode one image file on the texture cache worker", nullptr },
+    { "hytr_data_load_seconds", "Time to load and parse a data file (market, news, vendors, inventory, baked asset index)", nullptr },
+  };
+  static_assert(sizeof(s_histogramFamilies) / sizeof(s_histogramFamilies[0]) == static_cast<size_t>(MetricHistogram::MAX), "Missing histogram family");
+
+  // Frame buckets are dense around the 60 and 30 fps budgets
+  const double s_frameBounds[] = { 0.004, 0.008, 0.0125, 0.0167, 0.02, 0.025, 0.0333, 0.05, 0.1, 0.25, 1.0 };
+  const double s_decodeBounds[] = { 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0 };
+  const double s_loadBounds[] = { 0.001, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0 };
+
+  struct Bounds
+  {
+    const double* m_values;
+    size_t m_count;
+  };
+
+  const Bounds s_histogramBounds[] = {
+    { s_frameBounds, sizeof(s_frameBounds) / sizeof(s_frameBounds[0]) },
+    { s_decodeBounds, sizeof(s_decodeBounds) / sizeof(s_decodeBounds[0]) },
+    { s_loadBounds, sizeof(s_loadBounds) / sizeof(s_loadBounds[0]) },
+  };
+  static_assert(sizeof(s_histogramBounds) / sizeof(s_histogramBounds[0]) == static_cast<size_t>(MetricHistogram::MAX), "Missing histogram bounds");
+
+  void WriteFamilyHeader(std::ostream& stream, const Family& family, const char* type, const char*& lastName)
+  {
+    if (lastName && std::strcmp(lastName, family.m_name) == 0)
+      return;
+
+    lastName = family.m_name;
+    stream << "# HELP " << family.m_name << " " << family.m_help << "\n";
+    stream << "# TYPE " << family.m_name << " " << type << "\n";
+  }
+
+  void WriteSample(std::ostream& stream, const char* name, const char* suffix, const char* labels, const char* value)
+  {
+    stream << name << suffix;
+    if (labels)
+    {
+      stream << "{" << labels << "}";
+    }
+    stream << " " << value << "\n";
+  }
+}
+
+Metrics& Metrics::Get()
+{
+  return s_metrics;
+}
+
+void Metrics::Observe(MetricHistogram histogram, double seconds)
+{
+  int index = static_cast<int>(histogram);
+  const Bounds& bounds = s_histogramBounds[index];
+  size_t bucket = 0;
+  while (bucket < bounds.m_count && seconds > bounds.m_values[bucket])
+  {
+    ++bucket;
+  }
+
+  Histogram& target = m_histograms[index];
+  target.m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  target.m_count.fetch_add(1, std::memory_order_relaxed);
+  target.m_sumMicroseconds.fetch_add(static_cast<uint64_t>(seconds > 0.0 ? seconds * 1e6 : 0.0), std::memory_order_relaxed);
+}
+
+Metrics::HistogramSnapshot Metrics::GetHistogram(MetricHistogram histogram) const
+{
+  int index = static_cast<int>(histogram);
+  const Histogram& source = m_histograms[index];
+  HistogramSnapshot snapshot = {};
+  snapshot.m_bounds = s_histogramBounds[index].m_values;
+  snapshot.m_boundCount = s_histogramBounds[index].m_count;
+  for (size_t bucket = 0; bucket <= snapshot.m_boundCount; ++bucket)
+  {
+    snapshot.m_buckets[bucket] = source.m_buckets[bucket].load(std::memory_order_relaxed);
+  }
+  snapshot.m_count = source.m_count.load(std::memory_order_relaxed);
+  snapshot.m_sumSeconds = static_cast<double>(source.m_sumMicroseconds.load(std::memory_order_relaxed)) / 1e6;
+  return snapshot;
+}
+
+void Metrics::WritePrometheus(std::ostream& stream) const
+{
+  char value[64];
+  const char* lastName = nullptr;
+
+  for (int counter = 0; counter < static_cast<int>(MetricCounter::MAX); ++counter)
+  {
+    const Family& family = s_counterFamilies[counter];
+    WriteFamilyHeader(stream, family, "counter", lastName);
+    std::snprintf(value, sizeof(value), "%llu", static_cast<unsigned long long>(GetCounter(static_cast<MetricCounter>(counter))));
+    WriteSample(stream, family.m_name, "", family.m_labels, value);
+  }
+
+  for (int gauge = 0; gauge < static_cast<int>(MetricGauge::MAX); ++gauge)
+  {
+    const Family& family = s_gaugeFamilies[gauge];
+    WriteFamilyHeader(stream, family, "gauge", lastName);
+    std::snprintf(value, sizeof(value), "%lld", static_cast<long long>(GetGauge(static_cast<MetricGauge>(gauge))));
+    WriteSample(stream, family.m_name, "", family.m_labels, value);
+  }
+
+  // Bucket counts are read one by one while other threads observe, so the cumulative values
+  // can be off by the observations made during the snapshot; _count is taken from the buckets
+  // to keep the series self-consistent
+  for (int histogram = 0; histogram < static_cast<int>(MetricHistogram::MAX); ++histogram)
+  {
+    const Family& family = s_histogramFamilies[histogram];
+    WriteFamilyHeader(stream, family, "histogram", lastName);
+    HistogramSnapshot snapshot = GetHistogram(static_cast<MetricHistogram>(histogram));
+
+    uint64_t cumulative = 0;
+    char labels[64];
+    for (size_t bucket = 0; bucket <= snapshot.m_boundCount; ++bucket)
+    {
+      cumulative += snapshot.m_buckets[bucket];
+      if (bucket < snapshot.m_boundCount)
+      {
+        std::snprintf(labels, sizeof(labels), "le=\"%g\"", snapshot.m_bounds[bucket]);
+      }
+      else
+      {
+        std::snprintf(labels, sizeof(labels), "le=\"+Inf\"");
+      }
+      std::snprintf(value, sizeof(value), "%llu", static_cast<unsigned long long>(cumulative));
+      WriteSample(stream, family.m_name, "_bucket", labels, value);
+    }
+    std::snprintf(value, sizeof(value), "%.6f", snapshot.m_sumSeconds);
+    WriteSample(stream, family.m_name, "_sum", nullptr, value);
+    std::snprintf(value, sizeof(value), "%llu", static_cast<unsigned long long>(cumulative));
+    WriteSample(stream, family.m_name, "_count", nullptr, value);
+  }
+}
+
+MetricTimerScope::MetricTimerScope(MetricHistogram histogram)
+  : m_histogram(histogram)
+  , m_start(std::chrono::steady_clock::now())
+{
+}
+
+MetricTimerScope::~MetricTimerScope()
+{
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+  Metrics::Get().Observe(m_histogram, elapsed.count());
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+// Always-on runtime metrics for unattended installations. Updates are relaxed atomic
+// increments/stores with no locks and no allocation, so they are safe on hot paths and from
+// any thread; a reader (the metrics exporter) takes consistent-enough snapshots at any time.
+// WritePrometheus renders everything in the Prometheus text exposition format.
+
+// Monotonic counts since start
+enum class MetricCounter : uint8_t
+{
+  Frames,
+  MarketCycles,
+  Trades,
+  LogMessages,
+  LogWarnings,
+  LogErrors,
+  TextureDecodes,
+  TextureDecodeFailures,
+  MAX
+};
+
+// Last sampled values
+enum class MetricGauge : uint8_t
+{
+  TextureResidentBytes,
+  TextureDecodeQueueDepth,
+  MAX
+};
+
+// Distributions with fixed buckets (upper bounds in metrics.cpp)
+enum class MetricHistogram : uint8_t
+{
+  FrameSeconds,
+  TextureDecodeSeconds,
+  DataLoadSeconds,
+  MAX
+};
+
+class Metrics
+{
+public:
+  static constexpr size_t s_maxBuckets = 16; // Finite bounds per histogram; +Inf is implicit
+
+  struct HistogramSnapshot
+  {
+    const double* m_bounds;                 // Upper bounds in seconds, ascending
+    size_t m_boundCount;
+    uint64_t m_buckets[s_maxBuckets + 1];   // Per bucket (not cumulative), last one is +Inf
+    uint64_t m_count;
+    double m_sumSeconds;
+  };
+
+  static Metrics& Get();
+
+  void Add(MetricCounter counter, uint64_t amount = 1)
+  {
+    m_counters[static_cast<int>(counter)].fetch_add(amount, std::memory_order_relaxed);
+  }
+  void Set(MetricGauge gauge, int64_t value)
+  {
+    m_gauges[static_cast<int>(gauge)].store(value, std::memory_order_relaxed);
+  }
+  void Add(MetricGauge gauge, int64_t delta)
+  {
+    m_gauges[static_cast<int>(gauge)].fetch_add(delta, std::memory_order_relaxed);
+  }
+  void Observe(MetricHistogram histogram, double seconds);
+
+  uint64_t GetCounter(MetricCounter counter) const { return m_counters[static_cast<int>(counter)].load(std::memory_order_relaxed); }
+  int64_t GetGauge(MetricGauge gauge) const { return m_gauges[static_cast<int>(gauge)].load(std::memory_order_relaxed); }
+  HistogramSnapshot GetHistogram(MetricHistogram histogram) const;
+
+  // Prometheus text format, one family per counter, gauge and histogram ("hytr_" prefix)
+  void WritePrometheus(std::ostream& stream) const;
+
+private:
+  struct Histogram
+  {
+    std::atomic<uint64_t> m_buckets[s_maxBuckets + 1];
+    std::atomic<uint64_t> m_count;
+    std::atomic<uint64_t> m_sumMicroseconds;
+  };
+
+  // Plain atomics only, zero-initialized like MemoryTracker, so metrics can be updated during
+  // static initialization and from threads that outlive main
+  std::atomic<uint64_t> m_counters[static_cast<int>(MetricCounter::MAX)];
+  std::atomic<int64_t> m_gauges[static_cast<int>(MetricGauge::MAX)];
+  Histogram m_histograms[static_cast<int>(MetricHistogram::MAX)];
+};
+
+// Observes the lifetime of the enclosing block into a histogram
+class MetricTimerScope
+{
+public:
+  explicit MetricTimerScope(MetricHistogram histogram);
+  ~MetricTimerScope();
+  MetricTimerScope(const MetricTimerScope&) = delete;
+  MetricTimerScope& operator=(const MetricTimerScope&) = delete;
+
+private:
+  MetricHistogram m_histogram;
+  std::chrono::steady_clock::time_point m_start;
+};
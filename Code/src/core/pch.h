@@ -30,3 +30,9 @@
 #include "rapidjson/error/en.h"
 
 #include "redirections.h"
+#include "renderContext.h"
+#include "traceRecorder.h"
+#include "profiler.h"
+#include "memoryTracker.h"
+#include "metrics.h"
+#include "startupTimeline.h"
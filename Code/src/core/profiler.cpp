@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "profiler.h"
+#include <algorithm>
+
+constexpr int Profiler::s_noNode;
+constexpr size_t Profiler::s_historyFrames;
+
+Profiler& Profiler::Get()
+{
+  static Profiler s_profiler;
+  return s_profiler;
+}
+
+Profiler::Profiler()
+  : m_firstRoot(s_noNode)
+  , m_currentNode(s_noNode)
+  , m_frameStart(std::chrono::steady_clock::now())
+  , m_frameHistory()
+  , m_historyIndex(0)
+  , m_recordedFrames(0)
+{
+}
+
+void Profiler::BeginFrame()
+{
+  m_frameStart = std::chrono::steady_clock::now();
+}
+
+void Profiler::EndFrame()
+{
+  using Milliseconds = std::chrono::duration<float, std::milli>;
+
+  m_frameHistory[m_historyIndex] = Milliseconds(std::chrono::steady_clock::now() - m_frameStart).count();
+  for (Node& node : m_nodes)
+  {
+    node.m_history[m_historyIndex] = Milliseconds(node.m_frameTime).count();
+    node.m_lastCalls = node.m_frameCalls;
+    node.m_frameTime = std::chrono::steady_clock::duration::zero();
+    node.m_frameCalls = 0;
+  }
+
+  m_historyIndex = (m_historyIndex + 1) % s_historyFrames;
+  m_recordedFrames = std::min(m_recordedFrames + 1, s_historyFrames);
+}
+
+int Profiler::Enter(const char* name)
+{
+  m_currentNode = FindOrAddChild(m_currentNode, name);
+  return m_currentNode;
+}
+
+void Profiler::Leave(int node, std::chrono::steady_clock::duration elapsed)
+{
+  Node& entry = m_nodes[node];
+  entry.m_frameTime += elapsed;
+  ++entry.m_frameCalls;
+  m_currentNode = entry.m_parent;
+}
+
+int Profiler::FindOrAddChild(int parent, const char* name)
+{
+  // Siblings are few; a linear walk is cheaper than any lookup structure here
+  int* link = parent == s_noNode ? &m_firstRoot : &m_nodes[parent].m_firstChild;
+  while (*link != s_noNode)
+  {
+    if (m_nodes[*link].m_name == name)
+    {
+      return *link;
+    }
+    link = &m_nodes[*link].m_nextSibling;
+  }
+
+  Node node = {};
+  node.m_name = name;
+  node.m_parent = parent;
+  node.m_firstChild = s_noNode;
+  node.m_nextSibling = s_noNode;
+  node.m_depth = parent == s_noNode ? 0 : m_nodes[parent].m_depth + 1;
+  node.m_frameTime = std::chrono::steady_clock::duration::zero();
+
+  // The link points into m_nodes, so take the index before the vector may grow
+  int index = static_cast<int>(m_nodes.size());
+  *link = index;
+  m_nodes.push_back(node);
+  return index;
+}
+
+void Profiler::GetStats(std::vector<NodeStats>& stats) const
+{
+  stats.clear();
+  for (int node = m_firstRoot; node != s_noNode; node = m_nodes[node].m_nextSibling)
+  {
+    AppendStats(node, stats);
+  }
+}
+
+void Profiler::AppendStats(int node, std::vector<NodeStats>& stats) const
+{
+  const Node& entry = m_nodes[node];
+  NodeStats nodeStats;
+  nodeStats.m_name = entry.m_name;
+  nodeStats.m_depth = entry.m_depth;
+  nodeStats.m_lastMs = entry.m_history[(m_historyIndex + s_historyFrames - 1) % s_historyFrames];
+  nodeStats.m_calls = entry.m_lastCalls;
+  Summarize(entry.m_history, nodeStats.m_minMs, nodeStats.m_avgMs, nodeStats.m_p99Ms);
+  stats.push_back(nodeStats);
+
+  for (int child = entry.m_firstChild; child != s_noNode; child = m_nodes[child].m_nextSibling)
+  {
+    AppendStats(child, stats);
+  }
+}
+
+float Profiler::GetFrameMs(float& minMs, float& avgMs, float& p99Ms) const
+{
+  Summarize(m_frameHistory, minMs, avgMs, p99Ms);
+  return m_frameHistory[(m_historyIndex + s_historyFrames - 1) % s_historyFrames];
+}
+
+size_t Profiler::GetRecordedFrames() const
+{
+  return m_recordedFrames;
+}
+
+void Profiler::Summarize(const float* history, float& minMs, float& avgMs, float& p99Ms) const
+{
+  minMs = avgMs = p99Ms = 0.0f;
+  if (m_recordedFrames == 0)
+  {
+    return;
+  }
+
+  // Before the ring is full the recorded frames are the first m_recordedFrames slots
+  m_sortScratch.assign(history, history + m_recordedFrames);
+  float sum = 0.0f;
+  for (float sample : m_sortScratch)
+  {
+    sum += sample;
+  }
+  minMs = *std::min_element(m_sortScratch.begin(), m_sortScratch.end());
+  avgMs = sum / m_recordedFrames;
+
+  size_t p99Index = (m_recordedFrames * 99 + 99) / 100 - 1;
+  std::nth_element(m_sortScratch.begin(), m_sortScratch.begin() + p99Index, m_sortScratch.end());
+  p99Ms = m_sortScratch[p99Index];
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include "traceRecorder.h"
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Scoped frame profiler. PROFILE_SCOPE("Name") times the rest of the enclosing block; scopes
+// opened inside it become its children, so every frame forms a call tree. Each tree node keeps
+// the time it took in the last s_historyFrames frames for min/avg/p99 statistics. While the
+// trace recorder runs, scopes are also written to the trace as begin/end events.
+// Main thread only. Builds define PROFILER_ENABLED=0 to compile every scope out.
+class Profiler
+{
+public:
+  static constexpr int s_noNode = -1;
+  static constexpr size_t s_historyFrames = 240;
+
+  struct NodeStats
+  {
+    const char* m_name;
+    int m_depth;       // 0 for scopes opened outside any other scope
+    float m_lastMs;    // Time of the last finished frame
+    float m_minMs;
+    float m_avgMs;
+    float m_p99Ms;
+    uint32_t m_calls;  // Times the scope ran in the last finished frame
+  };
+
+  static Profiler& Get();
+
+  // Frame boundaries, called once per iteration of the main loop
+  void BeginFrame();
+  void EndFrame();
+
+  // Called by ProfileScope; names are compared by pointer, so pass string literals
+  int Enter(const char* name);
+  void Leave(int node, std::chrono::steady_clock::duration elapsed);
+
+  // Statistics of every node in depth-first order (children in first-entered order)
+  void GetStats(std::vector<NodeStats>& stats) const;
+  float GetFrameMs(float& minMs, float& avgMs, float& p99Ms) const; // Whole frame, returns the last one
+  size_t GetRecordedFrames() const;
+
+private:
+  Profiler();
+
+  struct Node
+  {
+    const char* m_name;
+    int m_parent;
+    int m_firstChild;
+    int m_nextSibling;
+    int m_depth;
+    std::chrono::steady_clock::duration m_frameTime;  // Accumulated in the running frame
+    uint32_t m_frameCalls;
+    uint32_t m_lastCalls;
+    float m_history[s_historyFrames];                 // Milliseconds per frame, ring buffer
+  };
+
+  int FindOrAddChild(int parent, const char* name);
+  void Summarize(const float* history, float& minMs, float& avgMs, float& p99Ms) const;
+  void AppendStats(int node, std::vector<NodeStats>& stats) const;
+
+  std::vector<Node> m_nodes;
+  int m_firstRoot;
+  int m_currentNode;   // Innermost open scope, s_noNode between scopes
+  std::chrono::steady_clock::time_point m_frameStart;
+  float m_frameHistory[s_historyFrames];
+  size_t m_historyIndex;   // Slot the next finished frame is written to
+  size_t m_recordedFrames;
+  mutable std::vector<float> m_sortScratch;
+};
+
+// Times the enclosing block as a node of the current frame's tree
+class ProfileScope
+{
+public:
+  explicit ProfileScope(const char* name)
+    : m_trace(name)
+    , m_node(Profiler::Get().Enter(name))
+    , m_start(std::chrono::steady_clock::now())
+  {
+  }
+
+  ~ProfileScope()
+  {
+    Profiler::Get().Leave(m_node, std::chrono::steady_clock::now() - m_start);
+  }
+
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+  TraceScope m_trace;  // Declared first: its end event is written after the timing stops
+  int m_node;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_BEGIN_FRAME() Profiler::Get().BeginFrame()
+#define PROFILE_END_FRAME() Profiler::Get().EndFrame()
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_BEGIN_FRAME() ((void)0)
+#define PROFILE_END_FRAME() ((void)0)
+#endif
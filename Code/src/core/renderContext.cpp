@@ -0,0 +1,204 @@
+#include "pch.h"
+#include "renderContext.h"
+#include <cstring>
+
+namespace
+{
+  // Glyph quads in a text: SFML skips spaces, tabs and line breaks
+  uint32_t CountGlyphs(const sf::String& string)
+  {
+    uint32_t glyphs = 0;
+    for (sf::Uint32 character : string)
+    {
+      if (character != ' ' && character != '\t' && character != '\n')
+      {
+        ++glyphs;
+      }
+    }
+    return glyphs;
+  }
+}
+
+RenderContext::RenderContext(sf::RenderTarget& target)
+  : m_target(target)
+  , m_currentType(-1)
+  , m_lastTexture(nullptr)
+  , m_lastShader(nullptr)
+  , m_hasLastState(false)
+{
+}
+
+void RenderContext::BeginFrame()
+{
+  m_frameStats.m_drawCalls = 0;
+  m_frameStats.m_vertices = 0;
+  m_frameStats.m_textureChanges = 0;
+  m_frameStats.m_shaderChanges = 0;
+  m_frameStats.m_blendChanges = 0;
+  m_frameStats.m_types.clear();
+  m_currentType = -1;
+  m_hasLastState = false;
+}
+
+void RenderContext::EndFrame()
+{
+  // Swapping keeps the capacity of both type lists, so no frame allocates
+  std::swap(m_lastFrameStats, m_frameStats);
+}
+
+void RenderContext::clear(const sf::Color& color)
+{
+  m_target.clear(color);
+}
+
+void RenderContext::draw(const sf::Sprite& sprite, const sf::RenderStates& states)
+{
+  if (sprite.getTexture())
+  {
+    Count(1, 4, sprite.getTexture(), states);
+  }
+  m_target.draw(sprite, states);
+}
+
+void RenderContext::draw(const sf::Text& text, const sf::RenderStates& states)
+{
+  uint32_t glyphs = CountGlyphs(text.getString());
+  if (text.getFont() && glyphs > 0)
+  {
+    const sf::Texture* glyphTexture = &text.getFont()->getTexture(text.getCharacterSize());
+    if (text.getOutlineThickness() != 0.0f)
+    {
+      Count(1, glyphs * 6, glyphTexture, states);
+    }
+    Count(1, glyphs * 6, glyphTexture, states);
+  }
+  m_target.draw(text, states);
+}
+
+void RenderContext::draw(const sf::Shape& shape, const sf::RenderStates& states)
+{
+  uint32_t points = static_cast<uint32_t>(shape.getPointCount());
+  if (points > 0)
+  {
+    // Triangle fan around the center, then a strip for the outline
+    Count(1, points + 2, shape.getTexture(), states);
+    if (shape.getOutlineThickness() != 0.0f)
+    {
+      Count(1, (points + 1) * 2, nullptr, states);
+    }
+  }
+  m_target.draw(shape, states);
+}
+
+void RenderContext::draw(const sf::VertexArray& vertices, const sf::RenderStates& states)
+{
+  if (vertices.getVertexCount() > 0)
+  {
+    Count(1, static_cast<uint32_t>(vertices.getVertexCount()), states.texture, states);
+  }
+  m_target.draw(vertices, states);
+}
+
+void RenderContext::draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+{
+  if (vertices && vertexCount > 0)
+  {
+    Count(1, static_cast<uint32_t>(vertexCount), states.texture, states);
+  }
+  m_target.draw(vertices, vertexCount, type, states);
+}
+
+void RenderContext::draw(const sf::Drawable& drawable, const sf::RenderStates& states)
+{
+  Count(1, 0, states.texture, states);
+  m_target.draw(drawable, states);
+}
+
+void RenderContext::setView(const sf::View& view)
+{
+  m_target.setView(view);
+}
+
+const sf::View& RenderContext::getView() const
+{
+  return m_target.getView();
+}
+
+const sf::View& RenderContext::getDefaultView() const
+{
+  return m_target.getDefaultView();
+}
+
+sf::Vector2u RenderContext::getSize() const
+{
+  return m_target.getSize();
+}
+
+sf::Vector2i RenderContext::mapCoordsToPixel(const sf::Vector2f& point, const sf::View& view) const
+{
+  return m_target.mapCoordsToPixel(point, view);
+}
+
+sf::Vector2f RenderContext::mapPixelToCoords(const sf::Vector2i& point, const sf::View& view) const
+{
+  return m_target.mapPixelToCoords(point, view);
+}
+
+void RenderContext::Count(uint32_t drawCalls, uint32_t vertices, const sf::Texture* texture, const sf::RenderStates& states)
+{
+  m_frameStats.m_drawCalls += drawCalls;
+  m_frameStats.m_vertices += vertices;
+
+  if (!m_hasLastState || texture != m_lastTexture)
+  {
+    ++m_frameStats.m_textureChanges;
+  }
+  if (!m_hasLastState || states.shader != m_lastShader)
+  {
+    ++m_frameStats.m_shaderChanges;
+  }
+  if (!m_hasLastState || states.blendMode != m_lastBlendMode)
+  {
+    ++m_frameStats.m_blendChanges;
+  }
+  m_lastTexture = texture;
+  m_lastShader = states.shader;
+  m_lastBlendMode = states.blendMode;
+  m_hasLastState = true;
+
+  if (m_currentType >= 0)
+  {
+    RenderStats::TypeStats& typeStats = m_frameStats.m_types[m_currentType];
+    typeStats.m_drawCalls += drawCalls;
+    typeStats.m_vertices += vertices;
+  }
+}
+
+int RenderContext::FindOrAddType(const char* typeName)
+{
+  // A handful of widget types; compare the names (RTTI names need not be unique pointers)
+  for (size_t i = 0; i < m_frameStats.m_types.size(); ++i)
+  {
+    if (m_frameStats.m_types[i].m_typeName == typeName || std::strcmp(m_frameStats.m_types[i].m_typeName, typeName) == 0)
+    {
+      return static_cast<int>(i);
+    }
+  }
+
+  RenderStats::TypeStats typeStats;
+  typeStats.m_typeName = typeName;
+  m_frameStats.m_types.push_back(typeStats);
+  return static_cast<int>(m_frameStats.m_types.size() - 1);
+}
+
+RenderContext::TypeScope::TypeScope(RenderContext& context, const char* typeName)
+  : m_context(context)
+  , m_previousType(context.m_currentType)
+{
+  m_context.m_currentType = m_context.FindOrAddType(typeName);
+}
+
+RenderContext::TypeScope::~TypeScope()
+{
+  m_context.m_currentType = m_previousType;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Draw statistics of one frame, in total and per widget type
+struct RenderStats
+{
+  struct TypeStats
+  {
+    const char* m_typeName = nullptr;  // As set by RenderContext::TypeScope
+    uint32_t m_drawCalls = 0;
+    uint32_t m_vertices = 0;
+  };
+
+  uint32_t m_drawCalls = 0;        // Draw calls SFML issues to OpenGL
+  uint32_t m_vertices = 0;
+  uint32_t m_textureChanges = 0;   // Draws with a different texture than the previous one
+  uint32_t m_shaderChanges = 0;
+  uint32_t m_blendChanges = 0;
+  std::vector<TypeStats> m_types; // In order of first draw within the frame
+};
+
+// What widgets draw into. Forwards to an SFML render target and counts, per frame, the draw
+// calls, vertices and state changes SFML will submit for them. The counts follow SFML's own
+// draw functions: a shape with an outline is two draw calls, text one per fill and outline,
+// and every glyph is two triangles.
+class RenderContext
+{
+public:
+  explicit RenderContext(sf::RenderTarget& target);
+
+  // Frame boundaries; EndFrame publishes the counts as GetLastFrameStats
+  void BeginFrame();
+  void EndFrame();
+  const RenderStats& GetFrameStats() const { return m_frameStats; }         // Running frame
+  const RenderStats& GetLastFrameStats() const { return m_lastFrameStats; } // Last finished frame
+
+  // Drawing
+  void clear(const sf::Color& color = sf::Color(0, 0, 0, 255));
+  void draw(const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+  void draw(const sf::Text& text, const sf::RenderStates& states = sf::RenderStates::Default);
+  void draw(const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+  void draw(const sf::VertexArray& vertices, const sf::RenderStates& states = sf::RenderStates::Default);
+  void draw(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+    const sf::RenderStates& states = sf::RenderStates::Default);
+  void draw(const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default); // Counted as one call
+
+  // View and coordinate mapping, as on sf::RenderTarget
+  void setView(const sf::View& view);
+  const sf::View& getView() const;
+  const sf::View& getDefaultView() const;
+  sf::Vector2u getSize() const;
+  sf::Vector2i mapCoordsToPixel(const sf::Vector2f& point, const sf::View& view) const;
+  sf::Vector2f mapPixelToCoords(const sf::Vector2i& point, const sf::View& view) const;
+
+  sf::RenderTarget& GetTarget() const { return m_target; }
+
+  // Attributes the draws inside the scope to a widget type (see WidgetContainer::DrawChildren)
+  class TypeScope
+  {
+  public:
+    TypeScope(RenderContext& context, const char* typeName);
+    ~TypeScope();
+    TypeScope(const TypeScope&) = delete;
+    TypeScope& operator=(const TypeScope&) = delete;
+
+  private:
+    RenderContext& m_context;
+    int m_previousType;
+  };
+
+private:
+  void Count(uint32_t drawCalls, uint32_t vertices, const sf::Texture* texture, const sf::RenderStates& states);
+  int FindOrAddType(const char* typeName);
+
+  sf::RenderTarget& m_target;
+  RenderStats m_frameStats;
+  RenderStats m_lastFrameStats;
+  int m_currentType;   // Index into m_frameStats.m_types, -1 outside any TypeScope
+
+  // State of the previous draw, to count changes the way SFML's state cache sees them
+  const sf::Texture* m_lastTexture;
+  const sf::Shader* m_lastShader;
+  sf::BlendMode m_lastBlendMode;
+  bool m_hasLastState;
+};
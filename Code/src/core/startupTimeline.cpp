@@ -0,0 +1,355 @@
+#include "pch.h"
+#include "startupTimeline.h"
+#include "rapidjson/ostreamwrapper.h"
+#include "rapidjson/prettywriter.h"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <sys/stat.h>
+
+constexpr int StartupTimeline::s_noPhase;
+
+namespace
+{
+  double ElapsedMs(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+  {
+    return std::chrono::duration<double, std::milli>(to - from).count();
+  }
+
+  const char* const s_kindNames[] = { "json", "texture", "image", "font" };
+  static_assert(sizeof(s_kindNames) / sizeof(s_kindNames[0]) == static_cast<size_t>(StartupAssetKind::MAX), "Missing asset kind name");
+}
+
+StartupTimeline& StartupTimeline::Get()
+{
+  static StartupTimeline s_timeline;
+  return s_timeline;
+}
+
+StartupTimeline::StartupTimeline()
+  : m_recording(false)
+  , m_totalMs(0.0)
+  , m_openPhase(s_noPhase)
+{
+}
+
+const char* StartupTimeline::GetKindName(StartupAssetKind kind)
+{
+  return kind < StartupAssetKind::MAX ? s_kindNames[static_cast<int>(kind)] : "?";
+}
+
+void StartupTimeline::Start()
+{
+  m_phases.clear();
+  m_openPhase = s_noPhase;
+  {
+    std::lock_guard<std::mutex> lock(m_assetMutex);
+    m_assets.clear();
+    m_assetIndex.clear();
+  }
+  m_mainThread = std::this_thread::get_id();
+  m_start = std::chrono::steady_clock::now();
+  m_totalMs = 0.0;
+  m_recording.store(true, std::memory_order_relaxed);
+}
+
+void StartupTimeline::Finish()
+{
+  if (!IsRecording())
+    return;
+
+  while (m_openPhase != s_noPhase)
+  {
+    EndPhase(m_openPhase);
+  }
+  m_totalMs = ElapsedMs(m_start, std::chrono::steady_clock::now());
+  m_recording.store(false, std::memory_order_relaxed);
+}
+
+int StartupTimeline::BeginPhase(const char* name)
+{
+  // Loaders shared with worker threads (data hot reload) open phases there too
+  if (!IsRecording() || std::this_thread::get_id() != m_mainThread)
+    return s_noPhase;
+
+  Phase phase = {};
+  phase.m_name = name;
+  phase.m_parent = m_openPhase;
+  phase.m_depth = m_openPhase == s_noPhase ? 0 : m_phases[m_openPhase].m_depth + 1;
+  phase.m_start = std::chrono::steady_clock::now();
+  phase.m_open = true;
+  m_phases.push_back(phase);
+  m_openPhase = static_cast<int>(m_phases.size()) - 1;
+  return m_openPhase;
+}
+
+void StartupTimeline::EndPhase(int phase)
+{
+  // Phases closed by Finish are ignored when their scope ends later
+  if (phase == s_noPhase || phase >= static_cast<int>(m_phases.size()) || !m_phases[phase].m_open)
+    return;
+
+  Phase& ended = m_phases[phase];
+  ended.m_open = false;
+  ended.m_wallMs = ElapsedMs(ended.m_start, std::chrono::steady_clock::now());
+  if (ended.m_parent != s_noPhase)
+  {
+    m_phases[ended.m_parent].m_childMs += ended.m_wallMs;
+  }
+  m_openPhase = ended.m_parent;
+}
+
+void StartupTimeline::RecordAsset(const std::string& path, StartupAssetKind kind, uint64_t bytes, double readMs, double decodeMs, bool loaded)
+{
+  if (!IsRecording())
+    return;
+
+  // Only the main thread opens phases, so loads on other threads belong to none
+  const char* phaseName = nullptr;
+  if (std::this_thread::get_id() == m_mainThread)
+  {
+    for (int phase = m_openPhase; phase != s_noPhase; phase = m_phases[phase].m_parent)
+    {
+      Phase& owner = m_phases[phase];
+      ++owner.m_assets;
+      owner.m_bytes += bytes;
+      owner.m_readMs += readMs;
+      owner.m_decodeMs += decodeMs;
+    }
+    phaseName = m_openPhase != s_noPhase ? m_phases[m_openPhase].m_name : nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(m_assetMutex);
+  auto found = m_assetIndex.find(path);
+  if (found == m_assetIndex.end())
+  {
+    AssetStats asset = {};
+    asset.m_path = path;
+    asset.m_kind = kind;
+    asset.m_phase = phaseName;
+    found = m_assetIndex.emplace(path, m_assets.size()).first;
+    m_assets.push_back(asset);
+  }
+
+  AssetStats& asset = m_assets[found->second];
+  ++asset.m_loads;
+  asset.m_failures += loaded ? 0 : 1;
+  asset.m_bytes += bytes;
+  asset.m_readMs += readMs;
+  asset.m_decodeMs += decodeMs;
+}
+
+void StartupTimeline::GetPhases(std::vector<PhaseStats>& phases) const
+{
+  phases.clear();
+  for (const Phase& phase : m_phases)
+  {
+    PhaseStats stats;
+    stats.m_name = phase.m_name;
+    stats.m_depth = phase.m_depth;
+    stats.m_wallMs = phase.m_wallMs;
+    stats.m_selfMs = std::max(0.0, phase.m_wallMs - phase.m_childMs);
+    stats.m_assets = phase.m_assets;
+    stats.m_bytes = phase.m_bytes;
+    stats.m_readMs = phase.m_readMs;
+    stats.m_decodeMs = phase.m_decodeMs;
+    phases.push_back(stats);
+  }
+}
+
+void StartupTimeline::GetAssets(std::vector<AssetStats>& assets) const
+{
+  {
+    std::lock_guard<std::mutex> lock(m_assetMutex);
+    assets = m_assets;
+  }
+  std::stable_sort(assets.begin(), assets.end(), [](const AssetStats& a, const AssetStats& b)
+  {
+    return a.m_readMs + a.m_decodeMs > b.m_readMs + b.m_decodeMs;
+  });
+}
+
+void StartupTimeline::WriteReport(std::ostream& stream, size_t assetCount) const
+{
+  std::vector<PhaseStats> phases;
+  GetPhases(phases);
+  std::vector<AssetStats> assets;
+  GetAssets(assets);
+
+  stream << std::fixed << std::setprecision(1);
+  stream << "Startup " << m_totalMs << " ms\n";
+  stream << std::left << std::setw(32) << "phase" << std::right
+    << std::setw(10) << "wall ms" << std::setw(10) << "self ms" << std::setw(8) << "assets"
+    << std::setw(12) << "bytes" << std::setw(10) << "read ms" << std::setw(11) << "decode ms" << '\n';
+  double phasedMs = 0.0;
+  for (const PhaseStats& phase : phases)
+  {
+    stream << std::left << std::setw(32) << (std::string(static_cast<size_t>(phase.m_depth) * 2, ' ') + phase.m_name) << std::right
+      << std::setw(10) << phase.m_wallMs << std::setw(10) << phase.m_selfMs << std::setw(8) << phase.m_assets
+      << std::setw(12) << phase.m_bytes << std::setw(10) << phase.m_readMs << std::setw(11) << phase.m_decodeMs << '\n';
+    if (phase.m_depth == 0)
+    {
+      phasedMs += phase.m_wallMs;
+    }
+  }
+  stream << std::left << std::setw(32) << "(outside phases)" << std::right << std::setw(10) << std::max(0.0, m_totalMs - phasedMs) << '\n';
+
+  // Totals per kind first, so a slow class of files shows even when no single file stands out
+  uint32_t kindLoads[static_cast<int>(StartupAssetKind::MAX)] = {};
+  uint64_t kindBytes[static_cast<int>(StartupAssetKind::MAX)] = {};
+  double kindMs[static_cast<int>(StartupAssetKind::MAX)] = {};
+  for (const AssetStats& asset : assets)
+  {
+    int kind = static_cast<int>(asset.m_kind);
+    kindLoads[kind] += asset.m_loads;
+    kindBytes[kind] += asset.m_bytes;
+    kindMs[kind] += asset.m_readMs + asset.m_decodeMs;
+  }
+  stream << "Asset loads by kind\n";
+  for (int kind = 0; kind < static_cast<int>(StartupAssetKind::MAX); ++kind)
+  {
+    stream << std::left << std::setw(10) << s_kindNames[kind] << std::right
+      << std::setw(8) << kindLoads[kind] << " loads" << std::setw(12) << kindBytes[kind] << " bytes"
+      << std::setw(10) << kindMs[kind] << " ms\n";
+  }
+
+  stream << "Slowest assets (of " << assets.size() << ")\n";
+  stream << std::setw(10) << "total ms" << std::setw(10) << "read ms" << std::setw(11) << "decode ms"
+    << std::setw(12) << "bytes" << std::setw(7) << "loads" << "  file [kind, phase]\n";
+  for (size_t index = 0; index < assets.size() && index < assetCount; ++index)
+  {
+    const AssetStats& asset = assets[index];
+    stream << std::setw(10) << asset.m_readMs + asset.m_decodeMs << std::setw(10) << asset.m_readMs
+      << std::setw(11) << asset.m_decodeMs << std::setw(12) << asset.m_bytes << std::setw(7) << asset.m_loads
+      << "  " << asset.m_path << " [" << s_kindNames[static_cast<int>(asset.m_kind)] << ", "
+      << (asset.m_phase ? asset.m_phase : "background") << "]";
+    if (asset.m_failures > 0)
+    {
+      stream << " FAILED x" << asset.m_failures;
+    }
+    stream << '\n';
+  }
+}
+
+void StartupTimeline::WriteJson(std::ostream& stream) const
+{
+  std::vector<PhaseStats> phases;
+  GetPhases(phases);
+  std::vector<AssetStats> assets;
+  GetAssets(assets);
+
+  Json::OStreamWrapper wrapper(stream);
+  Json::PrettyWriter<Json::OStreamWrapper> writer(wrapper);
+  writer.SetMaxDecimalPlaces(3);
+  writer.StartObject();
+  writer.Key("totalMs");
+  writer.Double(m_totalMs);
+
+  writer.Key("phases");
+  writer.StartArray();
+  for (const PhaseStats& phase : phases)
+  {
+    writer.StartObject();
+    writer.Key("name");
+    writer.String(phase.m_name);
+    writer.Key("depth");
+    writer.Int(phase.m_depth);
+    writer.Key("wallMs");
+    writer.Double(phase.m_wallMs);
+    writer.Key("selfMs");
+    writer.Double(phase.m_selfMs);
+    writer.Key("assets");
+    writer.Uint(phase.m_assets);
+    writer.Key("bytes");
+    writer.Uint64(phase.m_bytes);
+    writer.Key("readMs");
+    writer.Double(phase.m_readMs);
+    writer.Key("decodeMs");
+    writer.Double(phase.m_decodeMs);
+    writer.EndObject();
+  }
+  writer.EndArray();
+
+  writer.Key("assets");
+  writer.StartArray();
+  for (const AssetStats& asset : assets)
+  {
+    writer.StartObject();
+    writer.Key("path");
+    writer.String(asset.m_path.c_str());
+    writer.Key("kind");
+    writer.String(s_kindNames[static_cast<int>(asset.m_kind)]);
+    writer.Key("phase");
+    if (asset.m_phase)
+    {
+      writer.String(asset.m_phase);
+    }
+    else
+    {
+      writer.Null();
+    }
+    writer.Key("loads");
+    writer.Uint(asset.m_loads);
+    writer.Key("failures");
+    writer.Uint(asset.m_failures);
+    writer.Key("bytes");
+    writer.Uint64(asset.m_bytes);
+    writer.Key("readMs");
+    writer.Double(asset.m_readMs);
+    writer.Key("decodeMs");
+    writer.Double(asset.m_decodeMs);
+    writer.EndObject();
+  }
+  writer.EndArray();
+  writer.EndObject();
+  stream << '\n';
+}
+
+uint64_t StartupTimeline::GetFileBytes(const std::string& path)
+{
+  struct stat info;
+  return stat(path.c_str(), &info) == 0 ? static_cast<uint64_t>(info.st_size) : 0;
+}
+
+StartupAssetScope::StartupAssetScope(const std::string& path, StartupAssetKind kind)
+  : m_kind(kind)
+  , m_active(StartupTimeline::Get().IsRecording())
+  , m_read(false)
+  , m_bytes(0)
+{
+  if (m_active)
+  {
+    m_path = path;
+    m_start = std::chrono::steady_clock::now();
+  }
+}
+
+StartupAssetScope::~StartupAssetScope()
+{
+  Complete(true);
+}
+
+void StartupAssetScope::MarkRead(uint64_t bytes)
+{
+  if (!m_active)
+    return;
+
+  m_read = true;
+  m_bytes = bytes;
+  m_readEnd = std::chrono::steady_clock::now();
+}
+
+bool StartupAssetScope::Complete(bool loaded)
+{
+  if (!m_active)
+    return loaded;
+
+  m_active = false;
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  // Loaders that read and decode in one call report the size of the file they opened
+  uint64_t bytes = m_read ? m_bytes : StartupTimeline::GetFileBytes(m_path);
+  double readMs = m_read ? ElapsedMs(m_start, m_readEnd) : 0.0;
+  double decodeMs = ElapsedMs(m_read ? m_readEnd : m_start, end);
+  StartupTimeline::Get().RecordAsset(m_path, m_kind, bytes, readMs, decodeMs, loaded);
+  return loaded;
+}
@@ -0,0 +1,157 @@
+#pragma once
+#include "traceRecorder.h"  // PROFILE_CONCAT
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Cold start tracing. Between Start and Finish, STARTUP_PHASE("Name") times the rest of the
+// enclosing block as a phase (phases opened inside it become its children) and
+// StartupAssetScope times the load of one file. Every asset is charged to the innermost open
+// phase and its parents, so the report shows for each phase its wall and self time and how
+// much of it went to reading and decoding files, then the files sorted by load time.
+// Phases are main thread only; assets loaded on other threads (texture decoder) are listed
+// as background loads. Outside Start/Finish the scopes only test a flag.
+enum class StartupAssetKind : uint8_t
+{
+  Json,
+  Texture,
+  Image,
+  Font,
+  MAX
+};
+
+class StartupTimeline
+{
+public:
+  static constexpr int s_noPhase = -1;
+
+  struct PhaseStats
+  {
+    const char* m_name;
+    int m_depth;          // 0 for phases opened outside any other phase
+    double m_wallMs;
+    double m_selfMs;      // Wall time minus the wall time of the child phases
+    uint32_t m_assets;    // Asset loads in the phase and its children
+    uint64_t m_bytes;
+    double m_readMs;
+    double m_decodeMs;
+  };
+
+  struct AssetStats
+  {
+    std::string m_path;
+    StartupAssetKind m_kind;
+    const char* m_phase;  // Innermost phase of the first load, nullptr for background loads
+    uint32_t m_loads;     // The same file loaded more than once is one entry
+    uint32_t m_failures;
+    uint64_t m_bytes;     // Summed over all loads
+    double m_readMs;
+    double m_decodeMs;    // Includes the read time when the loader reads and decodes in one call
+  };
+
+  static StartupTimeline& Get();
+  static const char* GetKindName(StartupAssetKind kind);
+
+  // Clears the previous recording; called by the main thread before the first phase
+  void Start();
+  // Stops recording; phases still open are closed at this point
+  void Finish();
+  bool IsRecording() const { return m_recording.load(std::memory_order_relaxed); }
+
+  // Called by StartupPhaseScope; pass string literals
+  int BeginPhase(const char* name);
+  void EndPhase(int phase);
+  // Called by StartupAssetScope from any thread
+  void RecordAsset(const std::string& path, StartupAssetKind kind, uint64_t bytes, double readMs, double decodeMs, bool loaded);
+
+  double GetTotalMs() const { return m_totalMs; }
+  void GetPhases(std::vector<PhaseStats>& phases) const;   // Call order, depth-first
+  void GetAssets(std::vector<AssetStats>& assets) const;   // Slowest first
+  void WriteReport(std::ostream& stream, size_t assetCount) const;
+  void WriteJson(std::ostream& stream) const;
+
+  static uint64_t GetFileBytes(const std::string& path); // 0 if the file does not exist
+
+private:
+  StartupTimeline();
+
+  struct Phase
+  {
+    const char* m_name;
+    int m_parent;
+    int m_depth;
+    std::chrono::steady_clock::time_point m_start;
+    double m_wallMs;
+    double m_childMs;
+    bool m_open;
+    uint32_t m_assets;
+    uint64_t m_bytes;
+    double m_readMs;
+    double m_decodeMs;
+  };
+
+  std::atomic<bool> m_recording;
+  std::thread::id m_mainThread;
+  std::chrono::steady_clock::time_point m_start;
+  double m_totalMs;
+
+  std::vector<Phase> m_phases;            // Main thread only
+  int m_openPhase;
+
+  mutable std::mutex m_assetMutex;        // Assets are also recorded by loader threads
+  std::vector<AssetStats> m_assets;
+  std::unordered_map<std::string, size_t> m_assetIndex;
+};
+
+// Records the lifetime of the enclosing block as a startup phase
+class StartupPhaseScope
+{
+public:
+  explicit StartupPhaseScope(const char* name)
+    : m_phase(StartupTimeline::Get().BeginPhase(name))
+  {
+  }
+
+  ~StartupPhaseScope()
+  {
+    StartupTimeline::Get().EndPhase(m_phase);
+  }
+
+  StartupPhaseScope(const StartupPhaseScope&) = delete;
+  StartupPhaseScope& operator=(const StartupPhaseScope&) = delete;
+
+private:
+  int m_phase;
+};
+
+// Times the load of one file. The time up to MarkRead is read time, the rest is decode time;
+// loaders that read and decode in one call (SFML loadFromFile) skip MarkRead. Complete stops
+// the clock before the caller goes on to use the asset; otherwise the destructor does.
+class StartupAssetScope
+{
+public:
+  StartupAssetScope(const std::string& path, StartupAssetKind kind);
+  ~StartupAssetScope();
+  StartupAssetScope(const StartupAssetScope&) = delete;
+  StartupAssetScope& operator=(const StartupAssetScope&) = delete;
+
+  void MarkRead(uint64_t bytes);
+  bool Complete(bool loaded); // Returns loaded
+
+private:
+  std::string m_path;
+  StartupAssetKind m_kind;
+  bool m_active;
+  bool m_read;
+  uint64_t m_bytes;
+  std::chrono::steady_clock::time_point m_start;
+  std::chrono::steady_clock::time_point m_readEnd;
+};
+
+#define STARTUP_PHASE(name) StartupPhaseScope PROFILE_CONCAT(startupPhase, __LINE__)(name)
@@ -0,0 +1,214 @@
+#include "pch.h"
+#include "traceRecorder.h"
+#include <cstdio>
+
+constexpr size_t TraceRecorder::s_eventsPerThread;
+
+namespace
+{
+  // Names come from string literals, but keep the file valid whatever they contain
+  void WriteJsonString(std::ostream& stream, const char* text)
+  {
+    stream << '"';
+    for (const char* c = text ? text : ""; *c; ++c)
+    {
+      if (*c == '"' || *c == '\\')
+      {
+        stream << '\\';
+      }
+      if (static_cast<unsigned char>(*c) >= 0x20)
+      {
+        stream << *c;
+      }
+    }
+    stream << '"';
+  }
+}
+
+TraceRecorder& TraceRecorder::Get()
+{
+  static TraceRecorder s_recorder;
+  return s_recorder;
+}
+
+TraceRecorder::TraceRecorder()
+  : m_recording(false)
+  , m_epoch(std::chrono::steady_clock::now())
+  , m_startTime(m_epoch)
+{
+}
+
+void TraceRecorder::Start()
+{
+  if (IsRecording())
+  {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    for (auto& buffer : m_buffers)
+    {
+      buffer->m_count.store(0, std::memory_order_relaxed);
+      buffer->m_dropped.store(0, std::memory_order_relaxed);
+    }
+  }
+  m_startTime = std::chrono::steady_clock::now();
+  m_recording.store(true, std::memory_order_release);
+}
+
+bool TraceRecorder::Stop(const std::string& path)
+{
+  if (!IsRecording())
+  {
+    return false;
+  }
+  m_recording.store(false, std::memory_order_release);
+  const int64_t stopNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+
+  std::ofstream file(path);
+  if (!file)
+  {
+    return false;
+  }
+
+  // Timestamps are written in microseconds from the start of the capture
+  const int64_t startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(m_startTime - m_epoch).count();
+  char number[64];
+
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"HyperTrade\"}}";
+
+  std::lock_guard<std::mutex> lock(m_buffersMutex);
+  std::vector<const char*> openScopes;
+  for (const auto& buffer : m_buffers)
+  {
+    size_t count = buffer->m_count.load(std::memory_order_acquire);
+    openScopes.clear();
+    if (buffer->m_name)
+    {
+      file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->m_threadId << ",\"args\":{\"name\":";
+      WriteJsonString(file, buffer->m_name);
+      file << "}}";
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      const Event& event = buffer->m_events[i];
+      file << ",\n{\"name\":";
+      WriteJsonString(file, event.m_name);
+      std::snprintf(number, sizeof(number), "%.3f", (event.m_timeNs - startNs) / 1000.0);
+      file << ",\"ph\":\"" << event.m_phase << "\",\"ts\":" << number << ",\"pid\":1,\"tid\":" << buffer->m_threadId;
+      if (event.m_phase == 'C')
+      {
+        std::snprintf(number, sizeof(number), "%.17g", event.m_value);
+        file << ",\"args\":{\"value\":" << number << "}";
+      }
+      file << '}';
+
+      if (event.m_phase == 'B')
+      {
+        openScopes.push_back(event.m_name);
+      }
+      else if (event.m_phase == 'E' && !openScopes.empty())
+      {
+        openScopes.pop_back();
+      }
+    }
+
+    // Scopes still running on this thread when the capture stopped end at the stop time,
+    // otherwise the viewers drop or stretch them
+    std::snprintf(number, sizeof(number), "%.3f", (stopNs - startNs) / 1000.0);
+    while (!openScopes.empty())
+    {
+      file << ",\n{\"name\":";
+      WriteJsonString(file, openScopes.back());
+      file << ",\"ph\":\"E\",\"ts\":" << number << ",\"pid\":1,\"tid\":" << buffer->m_threadId << '}';
+      openScopes.pop_back();
+    }
+  }
+  file << "\n]}\n";
+  file.close();
+  return !file.fail();
+}
+
+float TraceRecorder::GetRecordedSeconds() const
+{
+  if (!IsRecording())
+  {
+    return 0.0f;
+  }
+  return std::chrono::duration<float>(std::chrono::steady_clock::now() - m_startTime).count();
+}
+
+size_t TraceRecorder::GetDroppedEvents() const
+{
+  std::lock_guard<std::mutex> lock(m_buffersMutex);
+  size_t dropped = 0;
+  for (const auto& buffer : m_buffers)
+  {
+    dropped += buffer->m_dropped.load(std::memory_order_relaxed);
+  }
+  return dropped;
+}
+
+void TraceRecorder::BeginEvent(const char* name)
+{
+  Record('B', name, 0.0);
+}
+
+void TraceRecorder::EndEvent(const char* name)
+{
+  Record('E', name, 0.0);
+}
+
+void TraceRecorder::Counter(const char* name, double value)
+{
+  Record('C', name, value);
+}
+
+void TraceRecorder::SetThreadName(const char* name)
+{
+  GetThreadBuffer().m_name = name;
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::GetThreadBuffer()
+{
+  // Registered once per thread; the recorder keeps the buffer after the thread ends
+  thread_local ThreadBuffer* t_buffer = nullptr;
+  if (!t_buffer)
+  {
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    m_buffers.push_back(std::make_unique<ThreadBuffer>());
+    t_buffer = m_buffers.back().get();
+    t_buffer->m_threadId = static_cast<uint32_t>(m_buffers.size());
+  }
+  return *t_buffer;
+}
+
+void TraceRecorder::Record(char phase, const char* name, double value)
+{
+  if (!IsRecording())
+  {
+    return;
+  }
+
+  ThreadBuffer& buffer = GetThreadBuffer();
+  size_t index = buffer.m_count.load(std::memory_order_relaxed);
+  if (index >= s_eventsPerThread)
+  {
+    buffer.m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  if (!buffer.m_events)
+  {
+    buffer.m_events.reset(new Event[s_eventsPerThread]);
+  }
+
+  Event& event = buffer.m_events[index];
+  event.m_name = name;
+  event.m_timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+  event.m_value = value;
+  event.m_phase = phase;
+  buffer.m_count.store(index + 1, std::memory_order_release);
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Records begin/end events, counters and thread names into a Chrome Trace Event JSON file that
+// chrome://tracing or ui.perfetto.dev can open. Every thread writes into its own fixed-size
+// buffer without locking; the buffers are only read by Stop, after recording was switched off.
+// Names are stored as pointers and must outlive the recording, so pass string literals.
+class TraceRecorder
+{
+public:
+  static TraceRecorder& Get();
+
+  void Start();
+  bool Stop(const std::string& path); // Writes the capture; false if not recording or the file failed
+  bool IsRecording() const { return m_recording.load(std::memory_order_relaxed); }
+  float GetRecordedSeconds() const;
+  size_t GetDroppedEvents() const;    // Events lost in the last capture because a buffer was full
+
+  void BeginEvent(const char* name);
+  void EndEvent(const char* name);
+  void Counter(const char* name, double value);
+  void SetThreadName(const char* name); // Names the calling thread in every later capture
+
+private:
+  TraceRecorder();
+
+  struct Event
+  {
+    const char* m_name;
+    int64_t m_timeNs;  // Since m_epoch
+    double m_value;    // Counter value
+    char m_phase;      // 'B', 'E' or 'C' as in the trace format
+  };
+
+  struct ThreadBuffer
+  {
+    const char* m_name = nullptr;
+    uint32_t m_threadId = 0;
+    std::unique_ptr<Event[]> m_events;       // Allocated by the owning thread on its first event
+    std::atomic<size_t> m_count{ 0 };        // Published with release after each event
+    std::atomic<size_t> m_dropped{ 0 };
+  };
+
+  ThreadBuffer& GetThreadBuffer();
+  void Record(char phase, const char* name, double value);
+
+  std::atomic<bool> m_recording;
+  std::chrono::steady_clock::time_point m_epoch;
+  std::chrono::steady_clock::time_point m_startTime;
+
+  mutable std::mutex m_buffersMutex;                 // Guards the list, taken once per thread
+  std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+
+  static constexpr size_t s_eventsPerThread = 256 * 1024;
+};
+
+// Begin/end event pair around the enclosing block; works on any thread
+class TraceScope
+{
+public:
+  explicit TraceScope(const char* name)
+    : m_name(TraceRecorder::Get().IsRecording() ? name : nullptr)
+  {
+    if (m_name)
+    {
+      TraceRecorder::Get().BeginEvent(m_name);
+    }
+  }
+
+  ~TraceScope()
+  {
+    // Only close what was opened, so a capture started inside the scope stays balanced
+    if (m_name)
+    {
+      TraceRecorder::Get().EndEvent(m_name);
+    }
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+  const char* m_name;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+// Same switch as the profiler: PROFILER_ENABLED=0 compiles tracing out as well
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+#if PROFILER_ENABLED
+#define TRACE_SCOPE(name) TraceScope PROFILE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_COUNTER(name, value) \
+  do { if (TraceRecorder::Get().IsRecording()) TraceRecorder::Get().Counter(name, static_cast<double>(value)); } while (0)
+#define TRACE_THREAD_NAME(name) TraceRecorder::Get().SetThreadName(name)
+#else
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_COUNTER(name, value) ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#endif
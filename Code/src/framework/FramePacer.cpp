@@ -0,0 +1,77 @@
+#include "pch.h"
+#include "FramePacer.h"
+#include <algorithm>
+
+namespace ui
+{
+  FramePacer::FramePacer()
+    : m_nextFrameTime(sf::Time::Zero)
+    , m_pollTime(sf::Time::Zero)
+    , m_previousPollTime(sf::Time::Zero)
+    , m_frameHasInput(false)
+  {
+  }
+
+  void FramePacer::Configure(sf::Window& window, const FramePacerSettings& settings)
+  {
+    m_settings = settings;
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(settings.m_verticalSync);
+    m_nextFrameTime = m_clock.getElapsedTime();
+  }
+
+  void FramePacer::WaitForNextFrame(bool idle)
+  {
+    // With vsync the driver blocks in display(); only idle frames need extra sleeping
+    unsigned int frameRate = idle ? m_settings.m_idleFrameRate : m_settings.m_targetFrameRate;
+    if (frameRate == 0 || (m_settings.m_verticalSync && !idle))
+    {
+      m_nextFrameTime = m_clock.getElapsedTime();
+      return;
+    }
+
+    sf::Time now = m_clock.getElapsedTime();
+    sf::Time frameTime = sf::microseconds(1000000 / frameRate);
+
+    // Fixed deadlines keep the average rate exact; after a long frame start over from now
+    // instead of rushing through several frames to catch up
+    m_nextFrameTime += frameTime;
+    if (m_nextFrameTime < now || m_nextFrameTime > now + frameTime)
+    {
+      m_nextFrameTime = now;
+      return;
+    }
+
+    sf::sleep(m_nextFrameTime - now);
+  }
+
+  void FramePacer::MarkInputPolled(bool hadInput)
+  {
+    m_previousPollTime = m_pollTime;
+    m_pollTime = m_clock.getElapsedTime();
+    m_frameHasInput = hadInput;
+  }
+
+  void FramePacer::MarkPresented()
+  {
+    if (!m_frameHasInput)
+    {
+      return;
+    }
+
+    sf::Time presented = m_clock.getElapsedTime();
+    double minMs = (presented - m_pollTime).asMicroseconds() / 1000.0;
+    double maxMs = (presented - m_previousPollTime).asMicroseconds() / 1000.0;
+
+    ++m_latency.m_samples;
+    m_latency.m_sumMinMs += minMs;
+    m_latency.m_sumMaxMs += maxMs;
+    m_latency.m_peakMaxMs = std::max(m_latency.m_peakMaxMs, maxMs);
+    m_frameHasInput = false;
+  }
+
+  void FramePacer::ResetLatencyStats()
+  {
+    m_latency = InputLatencyStats();
+  }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "pch.h"
+
+namespace ui
+{
+  struct FramePacerSettings
+  {
+    unsigned int m_targetFrameRate = 60; // Frames per second while something changes (0 = unlimited)
+    unsigned int m_idleFrameRate = 5;    // Frames per second while idle
+    bool m_verticalSync = false;         // Let the driver pace presentation instead of sleeping
+  };
+
+  // Input-to-present latency of the frames that had input since the last reset.
+  // SFML events carry no timestamp, so every sample is a range: the event arrived after the
+  // previous poll (upper bound) and at the latest right at this frame's poll (lower bound).
+  struct InputLatencyStats
+  {
+    uint32_t m_samples = 0;
+    double m_sumMinMs = 0.0;   // Poll to present
+    double m_sumMaxMs = 0.0;   // Previous poll to present
+    double m_peakMaxMs = 0.0;
+
+    double GetAverageMinMs() const { return m_samples ? m_sumMinMs / m_samples : 0.0; }
+    double GetAverageMaxMs() const { return m_samples ? m_sumMaxMs / m_samples : 0.0; }
+  };
+
+  // Replaces setFramerateLimit: sleeps at the start of a frame, before input is polled, so the
+  // time between reading input and presenting the frame is as short as possible.
+  class FramePacer
+  {
+  public:
+    FramePacer();
+
+    // Applies vsync and turns off SFML's own limiter, which sleeps after display()
+    void Configure(sf::Window& window, const FramePacerSettings& settings);
+    const FramePacerSettings& GetSettings() const { return m_settings; }
+
+    // Sleeps until the next frame is due at the target rate, or the idle rate when idle
+    void WaitForNextFrame(bool idle);
+
+    // Frame timeline markers used for the latency statistics
+    void MarkInputPolled(bool hadInput);
+    void MarkPresented();
+
+    const InputLatencyStats& GetLatencyStats() const { return m_latency; }
+    void ResetLatencyStats();
+
+  private:
+    FramePacerSettings m_settings;
+    sf::Clock m_clock;
+    sf::Time m_nextFrameTime;     // Deadline of the next frame on m_clock
+    sf::Time m_pollTime;          // When input was polled in this frame
+    sf::Time m_previousPollTime;  // When input was polled in the previous frame
+    bool m_frameHasInput;
+    InputLatencyStats m_latency;
+  };
+}
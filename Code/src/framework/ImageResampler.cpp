@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "ImageResampler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+  // Per-channel lookup from 8-bit sRGB to linear light
+  struct SrgbTable
+  {
+    float m_toLinear[256];
+
+    SrgbTable()
+    {
+      for (int i = 0; i < 256; ++i)
+      {
+        float c = static_cast<float>(i) / 255.0f;
+        m_toLinear[i] = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+      }
+    }
+  };
+
+  const SrgbTable& GetSrgbTable()
+  {
+    static const SrgbTable table;
+    return table;
+  }
+
+  sf::Uint8 LinearToSrgb(float value)
+  {
+    value = std::min(std::max(value, 0.0f), 1.0f);
+    float c = (value <= 0.0031308f) ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    return static_cast<sf::Uint8>(c * 255.0f + 0.5f);
+  }
+
+  // Resamples lineCount lines of RGBA floats along one axis.
+  // Element (line, pos) lives at (line * lineStride + pos * posStride) * 4.
+  void ResampleAxis(const std::vector<float>& src, std::vector<float>& dst,
+                    unsigned int srcLength, unsigned int dstLength, unsigned int lineCount,
+                    size_t srcLineStride, size_t srcPosStride,
+                    size_t dstLineStride, size_t dstPosStride)
+  {
+    const float scale = static_cast<float>(srcLength) / static_cast<float>(dstLength);
+    std::vector<float> weights;
+
+    for (unsigned int d = 0; d < dstLength; ++d)
+    {
+      // Source interval covered by this destination texel
+      const float begin = d * scale;
+      const float end = begin + scale;
+      const unsigned int first = static_cast<unsigned int>(begin);
+      const unsigned int last = std::min(srcLength, static_cast<unsigned int>(std::ceil(end)));
+
+      weights.clear();
+      for (unsigned int s = first; s < last; ++s)
+      {
+        float coverage = std::min(end, static_cast<float>(s + 1)) - std::max(begin, static_cast<float>(s));
+        weights.push_back(coverage / scale);
+      }
+
+      for (unsigned int line = 0; line < lineCount; ++line)
+      {
+        float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (size_t w = 0; w < weights.size(); ++w)
+        {
+          const float* texel = &src[(line * srcLineStride + (first + w) * srcPosStride) * 4];
+          for (int c = 0; c < 4; ++c)
+          {
+            sum[c] += texel[c] * weights[w];
+          }
+        }
+
+        float* out = &dst[(line * dstLineStride + d * dstPosStride) * 4];
+        for (int c = 0; c < 4; ++c)
+        {
+          out[c] = sum[c];
+        }
+      }
+    }
+  }
+}
+
+namespace ui
+{
+  sf::Image ResampleImage(const sf::Image& source, unsigned int width, unsigned int height)
+  {
+    const sf::Vector2u srcSize = source.getSize();
+    sf::Image result;
+
+    if (srcSize.x == 0 || srcSize.y == 0 || width == 0 || height == 0)
+    {
+      return result;
+    }
+
+    // Unpack to linear, premultiplied RGBA
+    const SrgbTable& table = GetSrgbTable();
+    const sf::Uint8* pixels = source.getPixelsPtr();
+    std::vector<float> linear(static_cast<size_t>(srcSize.x) * srcSize.y * 4);
+    for (size_t i = 0; i < linear.size(); i += 4)
+    {
+      float alpha = pixels[i + 3] / 255.0f;
+      linear[i + 0] = table.m_toLinear[pixels[i + 0]] * alpha;
+      linear[i + 1] = table.m_toLinear[pixels[i + 1]] * alpha;
+      linear[i + 2] = table.m_toLinear[pixels[i + 2]] * alpha;
+      linear[i + 3] = alpha;
+    }
+
+    // Separable filter: horizontal pass into (width x srcHeight), then vertical pass
+    std::vector<float> horizontal(static_cast<size_t>(width) * srcSize.y * 4);
+    ResampleAxis(linear, horizontal, srcSize.x, width, srcSize.y, srcSize.x, 1, width, 1);
+
+    std::vector<float> scaled(static_cast<size_t>(width) * height * 4);
+    ResampleAxis(horizontal, scaled, srcSize.y, height, width, 1, width, 1, width);
+
+    // Pack back to 8-bit sRGB with straight alpha
+    std::vector<sf::Uint8> packed(scaled.size());
+    for (size_t i = 0; i < scaled.size(); i += 4)
+    {
+      float alpha = scaled[i + 3];
+      float inverseAlpha = (alpha > 0.0f) ? 1.0f / alpha : 0.0f;
+      packed[i + 0] = LinearToSrgb(scaled[i + 0] * inverseAlpha);
+      packed[i + 1] = LinearToSrgb(scaled[i + 1] * inverseAlpha);
+      packed[i + 2] = LinearToSrgb(scaled[i + 2] * inverseAlpha);
+      packed[i + 3] = static_cast<sf::Uint8>(std::min(std::max(alpha, 0.0f), 1.0f) * 255.0f + 0.5f);
+    }
+
+    result.create(width, height, packed.data());
+    return result;
+  }
+}
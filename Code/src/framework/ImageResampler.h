@@ -0,0 +1,12 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+namespace ui
+{
+  // Resamples an image to the requested size with an area-averaging (box) filter.
+  // Colors are averaged in linear space with premultiplied alpha so that downscaled
+  // images keep their brightness and transparent edges don't bleed dark fringes.
+  // Used by the offline asset baker to pre-scale textures to their on-screen size
+  // and to build the hardware cursor image.
+  sf::Image ResampleImage(const sf::Image& source, unsigned int width, unsigned int height);
+}
@@ -0,0 +1,78 @@
+#include "pch.h"
+#include "InputQueue.h"
+
+namespace ui
+{
+  InputQueue::InputQueue()
+    : m_polledCount(0)
+    , m_lastEventIsMove(false)
+    , m_mouseMoved(false)
+    , m_lastMousePosition(0, 0)
+  {
+  }
+
+  void InputQueue::Collect(sf::Window& window)
+  {
+    Clear();
+
+    InputEvent event;
+    while (window.pollEvent(event))
+    {
+      Push(event);
+    }
+  }
+
+  void InputQueue::Clear()
+  {
+    m_events.clear();
+    m_polledCount = 0;
+    m_lastEventIsMove = false;
+    m_mouseMoved = false;
+  }
+
+  void InputQueue::Push(const InputEvent& event)
+  {
+    ++m_polledCount;
+
+    if (event.type == InputEvent::MouseMoved)
+    {
+      m_mouseMoved = true;
+      m_lastMousePosition = sf::Vector2i(event.mouseMove.x, event.mouseMove.y);
+
+      // Intermediate positions between two other events are never observed
+      if (m_lastEventIsMove)
+      {
+        m_events.back() = event;
+        return;
+      }
+      m_lastEventIsMove = true;
+    }
+    else
+    {
+      // Presses and releases carry their own position and must see the moves before them
+      m_lastEventIsMove = false;
+    }
+
+    m_events.push_back(event);
+  }
+
+  const std::vector<InputEvent>& InputQueue::GetEvents() const
+  {
+    return m_events;
+  }
+
+  bool InputQueue::HasMouseMoved() const
+  {
+    return m_mouseMoved;
+  }
+
+  sf::Vector2i InputQueue::GetLastMousePosition() const
+  {
+    return m_lastMousePosition;
+  }
+
+  size_t InputQueue::GetPolledCount() const
+  {
+    return m_polledCount;
+  }
+}
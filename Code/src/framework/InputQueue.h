@@ -0,0 +1,38 @@
+#pragma once
+#include "pch.h"
+#include <vector>
+
+namespace ui
+{
+  // Collects the window events of one frame before they are dispatched.
+  // Consecutive mouse moves are collapsed into the latest position, so the widget tree sees
+  // at most one move between two other events; every other event keeps its arrival order.
+  class InputQueue
+  {
+  public:
+    InputQueue();
+
+    // Polls all pending events, replacing the previous frame's queue
+    void Collect(sf::Window& window);
+
+    // Fills the queue without a window (scripted input); Push coalesces like Collect
+    void Clear();
+    void Push(const InputEvent& event);
+
+    const std::vector<InputEvent>& GetEvents() const;
+
+    // Latest pointer position reported by this frame's events
+    bool HasMouseMoved() const;
+    sf::Vector2i GetLastMousePosition() const;
+
+    // Number of events polled from the window before coalescing
+    size_t GetPolledCount() const;
+
+  private:
+    std::vector<InputEvent> m_events;
+    size_t m_polledCount;
+    bool m_lastEventIsMove;           // A following move overwrites the back of m_events
+    bool m_mouseMoved;
+    sf::Vector2i m_lastMousePosition;
+  };
+}
@@ -0,0 +1,251 @@
+#include "pch.h"
+#include "TextureCache.h"
+#include <algorithm>
+
+namespace ui
+{
+  TextureCache& TextureCache::Get()
+  {
+    static TextureCache cache;
+    return cache;
+  }
+
+  TextureCache::TextureCache()
+    : m_budgetBytes(s_defaultBudgetBytes)
+    , m_residentBytes(0)
+    , m_useCounter(0)
+    , m_stopping(false)
+  {
+  }
+
+  TextureCache::~TextureCache()
+  {
+    Shutdown();
+  }
+
+  void TextureCache::Prefetch(const std::string& path)
+  {
+    Entry& entry = m_entries[path];
+    entry.m_lastUse = ++m_useCounter;
+    if (entry.m_texture || entry.m_image || entry.m_queued || entry.m_failed)
+    {
+      return;
+    }
+
+    StartWorker();
+    entry.m_queued = true;
+    Metrics::Get().Add(MetricGauge::TextureDecodeQueueDepth, 1);
+    {
+      std::lock_guard<std::mutex> lock(m_queueMutex);
+      m_decodeQueue.push_back(path);
+    }
+    m_queueSignal.notify_one();
+  }
+
+  TextureCache::Status TextureCache::Request(const std::string& path, int drawWidth, int drawHeight, std::shared_ptr<const sf::Texture>& texture)
+  {
+    CollectDecoded();
+
+    Entry& entry = m_entries[path];
+    entry.m_lastUse = ++m_useCounter;
+
+    if (entry.m_texture)
+    {
+      texture = entry.m_texture;
+      return Status::Ready;
+    }
+    if (entry.m_failed)
+    {
+      return Status::Failed;
+    }
+    if (!entry.m_image)
+    {
+      Prefetch(path);
+      return Status::Pending;
+    }
+
+    // Upload on the main thread, which owns the GL context
+    std::shared_ptr<sf::Texture> uploaded = std::make_shared<sf::Texture>();
+    if (!uploaded->loadFromImage(*entry.m_image))
+    {
+      entry.m_failed = true;
+      m_residentBytes -= entry.m_bytes;
+      entry.m_bytes = 0;
+      entry.m_image.reset();
+      return Status::Failed;
+    }
+
+    sf::Vector2u size = uploaded->getSize();
+    uploaded->setSmooth(true);
+    size_t bytes = static_cast<size_t>(size.x) * size.y * 4;
+    if (static_cast<int>(size.x) > drawWidth || static_cast<int>(size.y) > drawHeight)
+    {
+      // Minified: sample from a mip chain (one third more memory)
+      if (uploaded->generateMipmap())
+      {
+        bytes += bytes / 3;
+      }
+    }
+
+    m_residentBytes = m_residentBytes - entry.m_bytes + bytes;
+    entry.m_bytes = bytes;
+    entry.m_image.reset();
+    entry.m_texture = uploaded;
+
+    texture = entry.m_texture;
+    EvictToBudget();
+    return Status::Ready;
+  }
+
+  void TextureCache::Update()
+  {
+    CollectDecoded();
+    EvictToBudget();
+    Metrics::Get().Set(MetricGauge::TextureResidentBytes, static_cast<int64_t>(m_residentBytes));
+  }
+
+  void TextureCache::Shutdown()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_queueMutex);
+      m_stopping = true;
+      m_decodeQueue.clear();
+    }
+    m_queueSignal.notify_all();
+    if (m_worker.joinable())
+    {
+      m_worker.join();
+    }
+
+    m_decoded.clear();
+    m_entries.clear();
+    m_residentBytes = 0;
+    Metrics::Get().Set(MetricGauge::TextureResidentBytes, 0);
+    Metrics::Get().Set(MetricGauge::TextureDecodeQueueDepth, 0);
+  }
+
+  void TextureCache::SetBudget(size_t bytes)
+  {
+    m_budgetBytes = bytes;
+    EvictToBudget();
+  }
+
+  size_t TextureCache::GetResidentBytes() const
+  {
+    return m_residentBytes;
+  }
+
+  size_t TextureCache::GetQueuedCount() const
+  {
+    size_t queued = 0;
+    for (const auto& entry : m_entries)
+    {
+      if (entry.second.m_queued)
+      {
+        ++queued;
+      }
+    }
+    return queued;
+  }
+
+  void TextureCache::StartWorker()
+  {
+    if (!m_worker.joinable() && !m_stopping)
+    {
+      m_worker = std::thread(&TextureCache::WorkerLoop, this);
+    }
+  }
+
+  void TextureCache::WorkerLoop()
+  {
+    TRACE_THREAD_NAME("TextureDecoder");
+    for (;;)
+    {
+      std::string path;
+      {
+        std::unique_lock<std::mutex> lock(m_queueMutex);
+        m_queueSignal.wait(lock, [this]() { return m_stopping || !m_decodeQueue.empty(); });
+        if (m_stopping)
+        {
+          return;
+        }
+        path = m_decodeQueue.front();
+        m_decodeQueue.pop_front();
+      }
+
+      // Decode without holding the lock
+      std::unique_ptr<sf::Image> image = std::make_unique<sf::Image>();
+      {
+        TRACE_SCOPE("DecodeImage");
+        MEMORY_TAG_SCOPE(MemoryTag::Loaders, "DecodeImage");
+        MetricTimerScope decodeTimer(MetricHistogram::TextureDecodeSeconds);
+        StartupAssetScope asset(path, StartupAssetKind::Image);
+        if (!asset.Complete(image->loadFromFile(path)))
+        {
+          image.reset();
+        }
+      }
+      Metrics::Get().Add(image ? MetricCounter::TextureDecodes : MetricCounter::TextureDecodeFailures);
+
+      std::lock_guard<std::mutex> lock(m_queueMutex);
+      m_decoded.emplace_back(path, std::move(image));
+    }
+  }
+
+  void TextureCache::CollectDecoded()
+  {
+    std::vector<std::pair<std::string, std::unique_ptr<sf::Image>>> decoded;
+    {
+      std::lock_guard<std::mutex> lock(m_queueMutex);
+      decoded.swap(m_decoded);
+    }
+
+    for (auto& result : decoded)
+    {
+      Entry& entry = m_entries[result.first];
+      entry.m_queued = false;
+      Metrics::Get().Add(MetricGauge::TextureDecodeQueueDepth, -1);
+      if (!result.second)
+      {
+        entry.m_failed = true;
+        continue;
+      }
+
+      sf::Vector2u size = result.second->getSize();
+      entry.m_bytes = static_cast<size_t>(size.x) * size.y * 4;
+      entry.m_image = std::move(result.second);
+      m_residentBytes += entry.m_bytes;
+    }
+  }
+
+  void TextureCache::EvictToBudget()
+  {
+    if (m_residentBytes <= m_budgetBytes)
+    {
+      return;
+    }
+
+    // Only textures no widget holds on to can go; oldest first
+    std::vector<std::pair<uint64_t, std::string>> candidates;
+    for (const auto& entry : m_entries)
+    {
+      bool unused = entry.second.m_texture ? entry.second.m_texture.use_count() == 1 : static_cast<bool>(entry.second.m_image);
+      if (unused)
+      {
+        candidates.emplace_back(entry.second.m_lastUse, entry.first);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& candidate : candidates)
+    {
+      if (m_residentBytes <= m_budgetBytes)
+      {
+        break;
+      }
+      auto it = m_entries.find(candidate.second);
+      m_residentBytes -= it->second.m_bytes;
+      m_entries.erase(it);
+    }
+  }
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace ui
+{
+  // Shared texture store for images that are loaded on demand.
+  // Files are decoded on a worker thread and uploaded on the main thread the first time
+  // they are requested. Textures not used by any widget are evicted least recently used
+  // first once the resident size exceeds the budget.
+  class TextureCache
+  {
+  public:
+    enum class Status
+    {
+      Pending,
+      Ready,
+      Failed
+    };
+
+    static TextureCache& Get();
+    ~TextureCache();
+
+    // Starts decoding a file in the background (no-op if resident or queued)
+    void Prefetch(const std::string& path);
+
+    // Returns Ready with the texture once decoded; drawWidth/drawHeight decide whether
+    // a mip chain is generated on upload. Must be called from the main thread.
+    Status Request(const std::string& path, int drawWidth, int drawHeight, std::shared_ptr<const sf::Texture>& texture);
+
+    // Per-frame maintenance: collects finished decodes and enforces the budget
+    void Update();
+    void Shutdown();
+
+    void SetBudget(size_t bytes);
+    size_t GetResidentBytes() const;
+    size_t GetQueuedCount() const; // Files sent to the worker whose result is not collected yet
+
+  private:
+    TextureCache();
+
+    struct Entry
+    {
+      std::shared_ptr<sf::Texture> m_texture;   // Uploaded texture, null until first request
+      std::unique_ptr<sf::Image> m_image;       // Decoded pixels waiting for upload
+      size_t m_bytes = 0;                       // Memory held by texture or image
+      uint64_t m_lastUse = 0;                   // Value of m_useCounter at the last request
+      bool m_queued = false;                    // Sent to the worker, result not collected yet
+      bool m_failed = false;                    // File could not be decoded
+    };
+
+    void WorkerLoop();
+    void CollectDecoded();
+    void EvictToBudget();
+    void StartWorker();
+
+    std::unordered_map<std::string, Entry> m_entries;   // Main thread only
+    size_t m_budgetBytes;
+    size_t m_residentBytes;
+    uint64_t m_useCounter;
+
+    // Worker communication
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueSignal;
+    std::deque<std::string> m_decodeQueue;
+    std::vector<std::pair<std::string, std::unique_ptr<sf::Image>>> m_decoded;  // Null image = decode failed
+    std::thread m_worker;
+    bool m_stopping;
+
+    static constexpr size_t s_defaultBudgetBytes = 32 * 1024 * 1024;
+  };
+}
@@ -12,6 +12,7 @@ namespace ui
     , m_hoverColor(sf::Color(200, 200, 200))
     , m_pressedColor(sf::Color(150, 150, 150))
     , m_onClickCallback(nullptr)
+    , m_onHoverCallback(nullptr)
   {
     // Set default text properties
     m_text.setFillColor(sf::Color::Black);
@@ -36,6 +37,11 @@ namespace ui
       if (wasHovered != m_isHovered)
       {
         ApplicationUpdateButtonState();
+
+        if (m_isHovered && m_onHoverCallback)
+        {
+          m_onHoverCallback();
+        }
       }
 
       return m_isHovered ? InputEventState::Handled : InputEventState::Unhandled;
@@ -149,6 +155,11 @@ namespace ui
     m_onClickCallback = callback;
   }
 
+  void WidgetButton::SetOnHoverCallback(std::function<void()> callback)
+  {
+    m_onHoverCallback = callback;
+  }
+
   void WidgetButton::ApplicationUpdateButtonState()
   {
     if (m_imageLoadStockProductsed)
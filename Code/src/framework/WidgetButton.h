@@ -16,6 +16,7 @@ namespace ui
     virtual InputEventState ProcessInput(const InputEvent& event) override;
     virtual void Draw(RenderContext& context) const override;
     virtual void UpdatePosition() override;
+    virtual bool IsPointerTarget() const override { return true; }
 
     // Button specific methods
     void SetText(const std::string& text);
@@ -26,9 +27,9 @@ namespace ui
     bool IsHovered() const;
     bool IsPressed() const;
     void SetOnClickCallback(std::function<void()> callback);
+    void SetOnHoverCallback(std::function<void()> callback);  // Called when the pointer enters the button
 
   private:
-    sf::Font m_font;
     sf::Text m_text;
     bool m_isHovered;
     bool m_isPressed;
@@ -36,6 +37,7 @@ namespace ui
     sf::Color m_hoverColor;
     sf::Color m_pressedColor;
     std::function<void()> m_onClickCallback;
+    std::function<void()> m_onHoverCallback;
 
     void ApplicationUpdateButtonState();
     bool IsPointInside(float x, float y) const;
@@ -1,8 +1,21 @@
 #include "pch.h"
 #include "WidgetContainer.h"
+#include "WidgetHitGrid.h"
+#include <typeinfo>
 
 namespace ui
 {
+  namespace
+  {
+    // Area of the world shown by a view (views are never rotated)
+    sf::FloatRect GetViewRect(const sf::View& view)
+    {
+      const sf::Vector2f& center = view.getCenter();
+      const sf::Vector2f& size = view.getSize();
+      return sf::FloatRect(center.x - size.x / 2.0f, center.y - size.y / 2.0f, size.x, size.y);
+    }
+  }
+
   WidgetContainer::WidgetContainer(int posX, int posY, int width, int height)
     : Widget(posX, posY, width, height)
   {
@@ -19,6 +32,18 @@ namespace ui
     if (!IsVisible())
       return InputEventState::Unhandled;
 
+    // The root makes sure positions are current before routing the event
+    if (!GetParent())
+    {
+      UpdateLayout();
+    }
+
+    // Mouse events only need to reach the widgets under the cursor
+    if (m_hitGrid && WidgetHitGrid::IsPointerEvent(event))
+    {
+      return m_hitGrid->Dispatch(*this, event);
+    }
+
     // Process input for all visible children, starting from the last added (top-most)
     // This allows for proper event handling in cases of overlapping widgets
     for (auto it = m_children.rbegin(); it != m_children.rend(); ++it)
@@ -33,17 +58,40 @@ namespace ui
 
   void WidgetContainer::Draw(RenderContext& context) const
   {
+    PROFILE_SCOPE("WidgetContainer::Draw");
+
     // Only draw if this container is visible
     if (!IsVisible())
       return;
 
-    // Draw all visible children in order (first added = bottom-most)
-    for (const auto& child : m_children)
+    if (!m_clipChildren)
     {
-      if (child->IsVisible())
+      DrawChildren(context);
+    }
+    else
+    {
+      // Draw through a view that shows exactly the visible part of the container rectangle in
+      // the matching part of the target. Nested clipping containers intersect with the current view.
+      const sf::View previousView = context.getView();
+      sf::FloatRect visibleRect;
+      GetDrawBounds(visibleRect);
+      if (!visibleRect.intersects(GetViewRect(previousView), visibleRect))
       {
-        child->Draw(context);
+        return;
       }
+
+      sf::Vector2i topLeft = context.mapCoordsToPixel(sf::Vector2f(visibleRect.left, visibleRect.top), previousView);
+      sf::Vector2i bottomRight = context.mapCoordsToPixel(
+        sf::Vector2f(visibleRect.left + visibleRect.width, visibleRect.top + visibleRect.height), previousView);
+      sf::Vector2f targetSize(static_cast<float>(context.getSize().x), static_cast<float>(context.getSize().y));
+
+      sf::View clipView(visibleRect);
+      clipView.setViewport(sf::FloatRect(topLeft.x / targetSize.x, topLeft.y / targetSize.y,
+        (bottomRight.x - topLeft.x) / targetSize.x, (bottomRight.y - topLeft.y) / targetSize.y));
+
+      context.setView(clipView);
+      DrawChildren(context);
+      context.setView(previousView);
     }
 
     // Draw debug bounds if enabled (after children so it's always visible on top)
@@ -58,6 +106,31 @@ namespace ui
     }
   }
 
+  void WidgetContainer::DrawChildren(RenderContext& context) const
+  {
+    // Children outside the current view (the window, or the clip rectangle of this or a parent
+    // container) are skipped
+    const sf::FloatRect viewRect = GetViewRect(context.getView());
+
+    // Draw in order (first added = bottom-most); draws are counted per widget type
+    for (const auto& child : m_children)
+    {
+      if (!child->IsVisible())
+      {
+        continue;
+      }
+
+      sf::FloatRect bounds;
+      if (child->GetDrawBounds(bounds) && !bounds.intersects(viewRect))
+      {
+        continue;
+      }
+
+      RenderContext::TypeScope typeScope(context, typeid(*child).name());
+      child->Draw(context);
+    }
+  }
+
   void WidgetContainer::AddWidget(WidgetPtr widget)
   {
     if (widget)
@@ -71,11 +144,10 @@ namespace ui
       // Convert relative position to absolute position based on container position
       if (m_layoutType == LayoutType::Native)
       {
-        // Calculate absolute position by adding container's absolute position
-        int absX = relX + GetPosAbsX();
-        int absY = relY + GetPosAbsY();
-
-        // Position calculation completed successfully
+        // Place it next to the other children; a move of this container that is still pending
+        // shifts it together with them
+        int absX = relX + GetPosAbsX() - m_pendingMoveX;
+        int absY = relY + GetPosAbsY() - m_pendingMoveY;
 
         widget->SetPosAbsX(absX);
         widget->SetPosAbsY(absY);
@@ -84,8 +156,20 @@ namespace ui
         widget->UpdatePosition();
       }
 
+      widget->SetParent(this);
+      bool childLayoutDirty = widget->IsLayoutDirty();
       m_children.push_back(std::move(widget));
-      ApplyLayout();
+
+      // Stacking layouts arrange all children once in the next layout pass
+      if (m_layoutType != LayoutType::Native)
+      {
+        InvalidateLayout();
+      }
+      if (childLayoutDirty)
+      {
+        MarkDescendantLayoutDirty();
+      }
+      InvalidateHitGrid();
     }
   }
 
@@ -99,13 +183,86 @@ namespace ui
     if (it != m_children.end())
     {
       m_children.erase(it);
-      ApplyLayout();
+      if (m_layoutType != LayoutType::Native)
+      {
+        InvalidateLayout();
+      }
+      InvalidateHitGrid();
     }
   }
 
   void WidgetContainer::ClearWidgets()
   {
     m_children.clear();
+    InvalidateHitGrid();
+  }
+
+  void WidgetContainer::CollectPointerTargets(std::vector<Widget*>& targets)
+  {
+    for (auto& child : m_children)
+    {
+      child->CollectPointerTargets(targets);
+    }
+  }
+
+  bool WidgetContainer::GetDrawBounds(sf::FloatRect& bounds) const
+  {
+    // Unclipped children can be anywhere; the container itself draws nothing but debug bounds
+    if (!m_clipChildren)
+    {
+      return false;
+    }
+    return Widget::GetDrawBounds(bounds);
+  }
+
+  void WidgetContainer::SetClipChildren(bool clip)
+  {
+    m_clipChildren = clip;
+  }
+
+  void WidgetContainer::SetPosAbsX(int posAbsX)
+  {
+    int deltaX = posAbsX - GetPosAbsX();
+    Widget::SetPosAbsX(posAbsX);
+    if (deltaX != 0)
+    {
+      m_pendingMoveX += deltaX;
+      InvalidateLayout();
+    }
+  }
+
+  void WidgetContainer::SetPosAbsY(int posAbsY)
+  {
+    int deltaY = posAbsY - GetPosAbsY();
+    Widget::SetPosAbsY(posAbsY);
+    if (deltaY != 0)
+    {
+      m_pendingMoveY += deltaY;
+      InvalidateLayout();
+    }
+  }
+
+  void WidgetContainer::EnableHitGrid(int cellSize)
+  {
+    m_hitGrid = std::make_unique<WidgetHitGrid>(GetPosAbsX(), GetPosAbsY(), GetWidth(), GetHeight(), cellSize);
+  }
+
+  WidgetHitGrid* WidgetContainer::GetHitGrid() const
+  {
+    return m_hitGrid.get();
+  }
+
+  void WidgetContainer::InvalidateHitGrid()
+  {
+    WidgetContainer* root = this;
+    while (root->GetParent())
+    {
+      root = root->GetParent();
+    }
+    if (root->m_hitGrid)
+    {
+      root->m_hitGrid->Invalidate();
+    }
   }
 
   size_t WidgetContainer::GetWidgetCount() const
@@ -123,19 +280,149 @@ namespace ui
   {
     m_layoutType = layout;
     m_spacing = spacing;
-    ApplyLayout();
+    InvalidateLayout();
   }
 
   void WidgetContainer::UpdateLayout()
   {
-    ApplyLayout();
+    MeasureLayout();
+    ArrangeLayout();
+  }
+
+  void WidgetContainer::MeasureLayout()
+  {
+    // Children first; a child container that changes size flags this one through OnChildResized
+    if (m_descendantLayoutDirty)
+    {
+      for (auto& child : m_children)
+      {
+        if (child->IsLayoutDirty())
+        {
+          child->MeasureLayout();
+        }
+      }
+    }
+
+    if (m_layoutDirty && m_layoutType != LayoutType::Native)
+    {
+      Measure();
+    }
+  }
+
+  void WidgetContainer::ArrangeLayout()
+  {
+    if (m_layoutDirty)
+    {
+      m_layoutDirty = false;
+      Arrange();
+    }
+
+    // Arrange may have moved child containers; they are handled right here
+    if (m_descendantLayoutDirty)
+    {
+      for (auto& child : m_children)
+      {
+        if (child->IsLayoutDirty())
+        {
+          child->ArrangeLayout();
+        }
+      }
+      m_descendantLayoutDirty = false;
+    }
+  }
+
+  bool WidgetContainer::IsLayoutDirty() const
+  {
+    return m_layoutDirty || m_descendantLayoutDirty;
   }
 
-  void WidgetContainer::ApplyLayout()
+  void WidgetContainer::InvalidateLayout()
   {
-    if (m_layoutType == LayoutType::Native || m_children.empty())
+    m_layoutDirty = true;
+    if (GetParent())
     {
-      return; // No layout adjustment needed
+      GetParent()->MarkDescendantLayoutDirty();
+    }
+  }
+
+  void WidgetContainer::OnChildResized()
+  {
+    // Only stacking layouts depend on the size of the children
+    if (m_layoutType != LayoutType::Native)
+    {
+      InvalidateLayout();
+    }
+  }
+
+  void WidgetContainer::MarkDescendantLayoutDirty()
+  {
+    // Parents of a flagged container are flagged already
+    for (WidgetContainer* container = this; container && !container->m_descendantLayoutDirty; container = container->GetParent())
+    {
+      container->m_descendantLayoutDirty = true;
+    }
+  }
+
+  void WidgetContainer::Measure()
+  {
+    if (m_children.empty())
+    {
+      return;
+    }
+
+    // Stacked along the layout direction, relative offsets kept across it
+    int contentWidth = 0;
+    int contentHeight = 0;
+    for (const auto& child : m_children)
+    {
+      if (m_layoutType == LayoutType::Horizontal)
+      {
+        contentWidth += child->GetWidth() + m_spacing;
+        contentHeight = std::max(contentHeight, child->GetPosRelY() + child->GetHeight());
+      }
+      else
+      {
+        contentWidth = std::max(contentWidth, child->GetPosRelX() + child->GetWidth());
+        contentHeight += child->GetHeight() + m_spacing;
+      }
+    }
+
+    // No spacing after the last child
+    if (m_layoutType == LayoutType::Horizontal)
+    {
+      contentWidth -= m_spacing;
+    }
+    else
+    {
+      contentHeight -= m_spacing;
+    }
+
+    // Only real changes notify the parent, so an unchanged size stops the propagation
+    if (contentWidth != GetWidth())
+    {
+      SetWidth(contentWidth);
+    }
+    if (contentHeight != GetHeight())
+    {
+      SetHeight(contentHeight);
+    }
+  }
+
+  void WidgetContainer::Arrange()
+  {
+    int moveX = m_pendingMoveX;
+    int moveY = m_pendingMoveY;
+    m_pendingMoveX = 0;
+    m_pendingMoveY = 0;
+
+    if (m_layoutType == LayoutType::Native)
+    {
+      // Manual positions: children keep their offset to the container
+      for (auto& child : m_children)
+      {
+        child->Translate(moveX, moveY);
+      }
+      return;
     }
 
     int currentX = GetPosAbsX();
@@ -4,6 +4,8 @@
 
 namespace ui
 {
+  class WidgetHitGrid;
+
   enum class LayoutType
   {
     Native,     // Manual positioning - widgets keep their original positions
@@ -20,6 +22,12 @@ namespace ui
     // Widget interface implementation
     virtual InputEventState ProcessInput(const InputEvent& event) override;
     virtual void Draw(RenderContext& context) const override;
+    virtual void CollectPointerTargets(std::vector<Widget*>& targets) override;
+    virtual bool GetDrawBounds(sf::FloatRect& bounds) const override;
+
+    // Moving a container moves its children along in the next layout pass
+    virtual void SetPosAbsX(int posAbsX) override;
+    virtual void SetPosAbsY(int posAbsY) override;
 
     // Container specific methods
     void AddWidget(WidgetPtr widget);
@@ -27,22 +35,57 @@ namespace ui
     void ClearWidgets();
     size_t GetWidgetCount() const;
 
-    // Layout management
+    // Spatial index for mouse events - enable on the root container only.
+    // Mouse move and button events are then routed to the widgets under the cursor
+    // instead of walking the whole tree.
+    void EnableHitGrid(int cellSize);
+    WidgetHitGrid* GetHitGrid() const;
+
+    // Layout management. Changes only mark containers dirty (up the tree, so the root knows
+    // where to look); UpdateLayout then lays out the dirty containers of the subtree in two
+    // passes. The measure pass runs children first: a dirty Horizontal or Vertical container
+    // sizes itself to the extent of its children, and a size change flags its parent in turn,
+    // so a resized child is propagated up within the same update. The arrange pass then runs
+    // parents first and places the children. The root runs it before input and drawing, so
+    // building or moving a tree costs one measure and arrangement per container instead of
+    // one per change. Native containers keep the size they were given.
     void SetLayout(LayoutType layout, int spacing = 0);
-    void UpdateLayout(); // Public method to trigger layout update
+    virtual void UpdateLayout() override;
+    virtual void MeasureLayout() override;
+    virtual void ArrangeLayout() override;
+    virtual bool IsLayoutDirty() const override;
+    void InvalidateLayout(); // Children have to be arranged again
+    void OnChildResized();   // Called by children whose size changed
     LayoutType GetLayout() const { return m_layoutType; }
     int GetSpacing() const { return m_spacing; }
 
+    // Children are cut at the container rectangle, both when drawn and for pointer hit tests.
+    // Without clipping, children may overflow the container and are only culled by the view.
+    void SetClipChildren(bool clip);
+    bool IsClippingChildren() const { return m_clipChildren; }
+
     // Debug drawing of container bounds
     void EnableDebugDraw(bool enable, sf::Color color = sf::Color(255, 0, 0, 80));
 
   private:
-    void ApplyLayout();
+    void Measure();
+    void Arrange();
+    void MarkDescendantLayoutDirty(); // Flags this container and its parents for the next pass
+    void InvalidateHitGrid(); // Structure changed, the root's grid has to be rebuilt
+    void DrawChildren(RenderContext& context) const;
 
     std::vector<WidgetPtr> m_children;
     bool m_debugDraw = false;
     sf::Color m_debugColor;
     LayoutType m_layoutType = LayoutType::Native;
     int m_spacing = 0;
+    std::unique_ptr<WidgetHitGrid> m_hitGrid;
+    bool m_clipChildren = false;
+
+    // Layout state
+    bool m_layoutDirty = false;            // Children have to be measured and arranged
+    bool m_descendantLayoutDirty = false;  // A container below this one is dirty
+    int m_pendingMoveX = 0;                // Container moved, Native children not yet
+    int m_pendingMoveY = 0;
   };
 }
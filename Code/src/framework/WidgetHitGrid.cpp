@@ -0,0 +1,224 @@
+#include "pch.h"
+#include "WidgetHitGrid.h"
+#include "WidgetContainer.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+namespace ui
+{
+  WidgetHitGrid::WidgetHitGrid(int posX, int posY, int width, int height, int cellSize)
+    : m_posX(posX)
+    , m_posY(posY)
+    , m_cellSize(std::max(cellSize, 1))
+    , m_needsRebuild(true)
+  {
+    m_columns = std::max((width + m_cellSize - 1) / m_cellSize, 1);
+    m_rows = std::max((height + m_cellSize - 1) / m_cellSize, 1);
+    m_cells.resize(static_cast<size_t>(m_columns) * m_rows);
+  }
+
+  void WidgetHitGrid::Invalidate()
+  {
+    m_needsRebuild = true;
+  }
+
+  void WidgetHitGrid::MarkMoved(Widget* widget)
+  {
+    if (m_needsRebuild)
+    {
+      return; // Everything is reinserted anyway
+    }
+
+    auto it = m_entryIndex.find(widget);
+    if (it != m_entryIndex.end() && !m_entries[it->second].m_moved)
+    {
+      m_entries[it->second].m_moved = true;
+      m_movedEntries.push_back(it->second);
+    }
+  }
+
+  bool WidgetHitGrid::IsPointerEvent(const InputEvent& event)
+  {
+    return event.type == InputEvent::MouseMoved
+      || event.type == InputEvent::MouseButtonPressed
+      || event.type == InputEvent::MouseButtonReleased;
+  }
+
+  InputEventState WidgetHitGrid::Dispatch(WidgetContainer& root, const InputEvent& event)
+  {
+    if (m_needsRebuild)
+    {
+      Rebuild(root);
+    }
+    ReinsertMoved();
+
+    bool isMove = event.type == InputEvent::MouseMoved;
+    int x = isMove ? event.mouseMove.x : event.mouseButton.x;
+    int y = isMove ? event.mouseMove.y : event.mouseButton.y;
+    std::vector<uint32_t>& engaged = isMove ? m_hoveredEntries : m_pressedEntries[event.mouseButton.button];
+
+    GatherCandidates(CellRow(y) * m_columns + CellColumn(x), engaged);
+
+    InputEventState result = InputEventState::Unhandled;
+    for (uint32_t entryIndex : m_candidates)
+    {
+      Widget* widget = m_entries[entryIndex].m_widget;
+      if (!widget->IsVisibleInTree())
+      {
+        continue;
+      }
+
+      // Parts cut away by a clipping container are not there for the pointer either; widgets
+      // that are hovered or pressed still get the event so they can leave that state
+      if (widget->IsPointClipped(x, y) && !std::binary_search(engaged.begin(), engaged.end(), entryIndex, std::greater<uint32_t>()))
+      {
+        continue;
+      }
+
+      result = widget->ProcessInput(event);
+      bool handled = result == InputEventState::Handled;
+
+      // Track who is hovered or pressed: a move answers "inside" or "outside",
+      // a press only adds, a release ends the press whatever the answer
+      if (event.type == InputEvent::MouseButtonReleased || (isMove && !handled))
+      {
+        EraseSorted(engaged, entryIndex);
+      }
+      else if (handled)
+      {
+        InsertSorted(engaged, entryIndex);
+      }
+
+      if (handled)
+      {
+        break; // Stop here like the tree walk; the handler may also have changed the tree
+      }
+    }
+    return result;
+  }
+
+  void WidgetHitGrid::Rebuild(WidgetContainer& root)
+  {
+    std::vector<Widget*> targets;
+    root.CollectPointerTargets(targets);
+
+    for (auto& cell : m_cells)
+    {
+      cell.clear();
+    }
+    m_entries.clear();
+    m_entryIndex.clear();
+    m_movedEntries.clear();
+
+    m_entries.reserve(targets.size());
+    for (Widget* widget : targets)
+    {
+      Entry entry = { widget, 0, 0, -1, -1, false };
+      m_entryIndex[widget] = static_cast<uint32_t>(m_entries.size());
+      m_entries.push_back(entry);
+    }
+
+    // Inserting in reverse draw order keeps every cell sorted top-most first
+    for (size_t i = m_entries.size(); i-- > 0;)
+    {
+      Insert(static_cast<uint32_t>(i));
+    }
+
+    // Hover and press state of the old entries is unknown: treat every target as engaged
+    // once, the next events narrow the lists down again
+    m_hoveredEntries.resize(m_entries.size());
+    for (size_t i = 0; i < m_entries.size(); ++i)
+    {
+      m_hoveredEntries[i] = static_cast<uint32_t>(m_entries.size() - 1 - i);
+    }
+    for (auto& pressedEntries : m_pressedEntries)
+    {
+      pressedEntries = m_hoveredEntries;
+    }
+    m_needsRebuild = false;
+  }
+
+  void WidgetHitGrid::ReinsertMoved()
+  {
+    for (uint32_t entryIndex : m_movedEntries)
+    {
+      Remove(entryIndex);
+      Insert(entryIndex);
+      m_entries[entryIndex].m_moved = false;
+    }
+    m_movedEntries.clear();
+  }
+
+  void WidgetHitGrid::Insert(uint32_t entryIndex)
+  {
+    Entry& entry = m_entries[entryIndex];
+    const Widget* widget = entry.m_widget;
+
+    // Bounds are inclusive on the right and bottom edge, like WidgetButton's hit test
+    entry.m_cellMinX = CellColumn(widget->GetPosAbsX());
+    entry.m_cellMinY = CellRow(widget->GetPosAbsY());
+    entry.m_cellMaxX = CellColumn(widget->GetPosAbsX() + widget->GetWidth());
+    entry.m_cellMaxY = CellRow(widget->GetPosAbsY() + widget->GetHeight());
+
+    for (int row = entry.m_cellMinY; row <= entry.m_cellMaxY; ++row)
+    {
+      for (int column = entry.m_cellMinX; column <= entry.m_cellMaxX; ++column)
+      {
+        InsertSorted(m_cells[row * m_columns + column], entryIndex);
+      }
+    }
+  }
+
+  void WidgetHitGrid::Remove(uint32_t entryIndex)
+  {
+    const Entry& entry = m_entries[entryIndex];
+    for (int row = entry.m_cellMinY; row <= entry.m_cellMaxY; ++row)
+    {
+      for (int column = entry.m_cellMinX; column <= entry.m_cellMaxX; ++column)
+      {
+        EraseSorted(m_cells[row * m_columns + column], entryIndex);
+      }
+    }
+  }
+
+  int WidgetHitGrid::CellColumn(int x) const
+  {
+    // Positions outside the grid map to the border cells
+    int column = (x - m_posX) / m_cellSize;
+    return std::min(std::max(column, 0), m_columns - 1);
+  }
+
+  int WidgetHitGrid::CellRow(int y) const
+  {
+    int row = (y - m_posY) / m_cellSize;
+    return std::min(std::max(row, 0), m_rows - 1);
+  }
+
+  void WidgetHitGrid::GatherCandidates(int cell, const std::vector<uint32_t>& engaged)
+  {
+    // Merge both lists, keeping top-most first order and visiting shared widgets once
+    const std::vector<uint32_t>& current = m_cells[cell];
+    m_candidates.clear();
+    std::set_union(current.begin(), current.end(), engaged.begin(), engaged.end(),
+      std::back_inserter(m_candidates), std::greater<uint32_t>());
+  }
+
+  void WidgetHitGrid::InsertSorted(std::vector<uint32_t>& entries, uint32_t entryIndex)
+  {
+    auto it = std::lower_bound(entries.begin(), entries.end(), entryIndex, std::greater<uint32_t>());
+    if (it == entries.end() || *it != entryIndex)
+    {
+      entries.insert(it, entryIndex);
+    }
+  }
+
+  void WidgetHitGrid::EraseSorted(std::vector<uint32_t>& entries, uint32_t entryIndex)
+  {
+    auto it = std::lower_bound(entries.begin(), entries.end(), entryIndex, std::greater<uint32_t>());
+    if (it != entries.end() && *it == entryIndex)
+    {
+      entries.erase(it);
+    }
+  }
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "widget.h"
+#include <unordered_map>
+#include <vector>
+
+namespace ui
+{
+  class WidgetContainer;
+
+  // Uniform grid over the absolute rectangles of the pointer targets below a root container.
+  // Every cell lists the targets overlapping it, top-most (last drawn) first, so a mouse event
+  // only visits the few widgets near the cursor. Moved widgets are reinserted lazily before
+  // the next query; adding or removing widgets rebuilds the grid.
+  class WidgetHitGrid
+  {
+  public:
+    WidgetHitGrid(int posX, int posY, int width, int height, int cellSize);
+
+    void Invalidate();                 // Structure changed, rebuild before the next query
+    void MarkMoved(Widget* widget);    // Rectangle changed, reinsert before the next query
+
+    // Routes a mouse event in top-most first order until a widget handles it
+    InputEventState Dispatch(WidgetContainer& root, const InputEvent& event);
+
+    static bool IsPointerEvent(const InputEvent& event);
+
+  private:
+    struct Entry
+    {
+      Widget* m_widget;
+      int m_cellMinX;   // Inclusive cell range the widget is stored in
+      int m_cellMinY;
+      int m_cellMaxX;
+      int m_cellMaxY;
+      bool m_moved;     // Waiting in m_movedEntries
+    };
+
+    void Rebuild(WidgetContainer& root);
+    void ReinsertMoved();
+    void Insert(uint32_t entryIndex);
+    void Remove(uint32_t entryIndex);
+    int CellColumn(int x) const;
+    int CellRow(int y) const;
+    void GatherCandidates(int cell, const std::vector<uint32_t>& engaged);
+    static void InsertSorted(std::vector<uint32_t>& entries, uint32_t entryIndex);
+    static void EraseSorted(std::vector<uint32_t>& entries, uint32_t entryIndex);
+
+    int m_posX;
+    int m_posY;
+    int m_cellSize;
+    int m_columns;
+    int m_rows;
+    bool m_needsRebuild;
+
+    std::vector<Entry> m_entries;                          // Index = draw order
+    std::unordered_map<const Widget*, uint32_t> m_entryIndex;
+    std::vector<std::vector<uint32_t>> m_cells;            // Entry indices, descending
+    std::vector<uint32_t> m_movedEntries;
+    std::vector<uint32_t> m_candidates;                    // Scratch for Dispatch
+
+    // Widgets that took a move or press and have not seen the matching move-out or release yet.
+    // They get the next event wherever the cursor is so they can leave that state, exactly as
+    // they would with the full tree walk.
+    std::vector<uint32_t> m_hoveredEntries;
+    std::vector<uint32_t> m_pressedEntries[sf::Mouse::ButtonCount];
+  };
+}
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "WidgetImage.h"
+#include "TextureCache.h"
 #include "../application/application.h"
 
 namespace ui
@@ -27,7 +28,18 @@ namespace ui
   void WidgetImage::Draw(RenderContext& context) const
   {
     // Only draw if widget is visible
-    if (IsVisible() && m_imageLoadStockProductsed)
+    if (!IsVisible())
+    {
+      return;
+    }
+
+    // First draw after a lazy load request: bind the texture once the cache has it
+    if (!m_lazyImagePath.empty())
+    {
+      ResolveLazyImage();
+    }
+
+    if (m_imageLoadStockProductsed)
     {
       context.draw(m_sprite);
     }
@@ -35,21 +47,39 @@ namespace ui
 
   bool WidgetImage::LoadImage(const std::string& imagePath)
   {
-    // Use Application's static assets path directly
-    std::string fullPath = Application::s_assetsPath + imagePath;
+    // An eager load replaces any pending lazy one
+    m_lazyImagePath.clear();
+    m_sharedTexture.reset();
+    m_sharedTexturePath.clear();
 
-    if (m_texture.loadFromFile(fullPath))
+    // Prefer the baked (pre-scaled) copy of the texture when the asset baker produced one
+    std::string fullPath = Application::ResolveTexturePath(imagePath);
+
+    StartupAssetScope asset(fullPath, StartupAssetKind::Texture);
+    if (asset.Complete(m_texture.loadFromFile(fullPath)))
     {
-      m_sprite.setTexture(m_texture);
+      ApplyTexture(m_texture);
 
-      // Set the position based on widget coordinates
-      m_sprite.setPosition(static_cast<float>(GetPosAbsX()), static_cast<float>(GetPosAbsY()));
+      float scaleX = m_sprite.getScale().x;
+      float scaleY = m_sprite.getScale().y;
 
-      // Scale the image to fit the widget dimensions if needed
-      sf::Vector2u textureSize = m_texture.getSize();
-      float scaleX = static_cast<float>(GetWidth()) / textureSize.x;
-      float scaleY = static_cast<float>(GetHeight()) / textureSize.y;
-      m_sprite.setScale(scaleX, scaleY);
+      // Filter when the texture is drawn at a different size; when it is still shrunk
+      // (shared textures drawn at several sizes) sample from a mip chain to avoid aliasing
+      m_texture.setSmooth(scaleX != 1.0f || scaleY != 1.0f);
+      if (scaleX < 1.0f || scaleY < 1.0f)
+      {
+        m_texture.generateMipmap();
+      }
+
+#ifdef _DEBUG
+      // Textures drawn at less than half their size should be listed in data/asset_manifest.json
+      if (scaleX < 0.5f && scaleY < 0.5f)
+      {
+        sf::Vector2u textureSize = m_texture.getSize();
+        DebugLog("Texture " + imagePath + " is " + std::to_string(textureSize.x) + "x" + std::to_string(textureSize.y)
+          + " but drawn at " + std::to_string(GetWidth()) + "x" + std::to_string(GetHeight()) + ", consider baking it", DebugType::Warning);
+      }
+#endif
 
       m_imageLoadStockProductsed = true;
       return true;
@@ -61,6 +91,60 @@ namespace ui
     }
   }
 
+  void WidgetImage::LoadImageLazy(const std::string& imagePath)
+  {
+    std::string fullPath = Application::ResolveTexturePath(imagePath);
+    if (m_lazyImagePath.empty() && m_sharedTexture && m_sharedTexturePath == fullPath)
+    {
+      return; // Already showing this image
+    }
+
+    // Hide the previous image until the new one is ready rather than showing a stale one
+    m_lazyImagePath = fullPath;
+    m_sharedTexture.reset();
+    m_sharedTexturePath.clear();
+    m_imageLoadStockProductsed = false;
+    TextureCache::Get().Prefetch(fullPath);
+  }
+
+  void WidgetImage::ApplyTexture(const sf::Texture& texture) const
+  {
+    m_sprite.setTexture(texture, true);
+
+    // Set the position based on widget coordinates
+    m_sprite.setPosition(static_cast<float>(GetPosAbsX()), static_cast<float>(GetPosAbsY()));
+
+    // Scale the image to fit the widget dimensions if needed
+    sf::Vector2u textureSize = texture.getSize();
+    float scaleX = static_cast<float>(GetWidth()) / textureSize.x;
+    float scaleY = static_cast<float>(GetHeight()) / textureSize.y;
+    m_sprite.setScale(scaleX, scaleY);
+
+    m_imageLoadStockProductsed = true;
+  }
+
+  void WidgetImage::ResolveLazyImage() const
+  {
+    std::shared_ptr<const sf::Texture> texture;
+    TextureCache::Status status = TextureCache::Get().Request(m_lazyImagePath, GetWidth(), GetHeight(), texture);
+    if (status == TextureCache::Status::Pending)
+    {
+      return;
+    }
+
+    if (status == TextureCache::Status::Failed)
+    {
+      DebugLog("Failed to load image " + m_lazyImagePath, DebugType::Warning);
+    }
+    else
+    {
+      m_sharedTexture = texture;
+      m_sharedTexturePath = m_lazyImagePath;
+      ApplyTexture(*texture);
+    }
+    m_lazyImagePath.clear();
+  }
+
   void WidgetImage::SetPosition(float x, float y)
   {
     m_sprite.setPosition(x, y);
@@ -23,10 +23,22 @@ namespace ui
     void SetPosition(float x, float y);
     void SetScale(float scaleX, float scaleY);
 
+    // Deferred loading through TextureCache: decoding starts now in the background and the
+    // texture is bound the first time the widget is drawn after it is ready
+    void LoadImageLazy(const std::string& imagePath);
+
   protected:
+    void ApplyTexture(const sf::Texture& texture) const;
+    void ResolveLazyImage() const;
+
     sf::Texture m_texture;
-    sf::Sprite m_sprite;
-    bool m_imageLoadStockProductsed;
+    mutable sf::Sprite m_sprite;
+    mutable bool m_imageLoadStockProductsed;
+
+    // Lazy loading state (resolved from const Draw)
+    mutable std::shared_ptr<const sf::Texture> m_sharedTexture;  // Texture owned by TextureCache
+    mutable std::string m_sharedTexturePath;                     // Path of m_sharedTexture
+    mutable std::string m_lazyImagePath;                         // Path waiting to be bound, empty if none
   };
 
   using WidgetImagePtr = std::unique_ptr<WidgetImage>;
@@ -0,0 +1,236 @@
+#include "pch.h"
+#include "WidgetListView.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ui
+{
+  namespace
+  {
+    const float s_scrollEaseRate = 15.0f;   // Fraction of the remaining distance covered per second
+  }
+
+  const size_t WidgetListView::s_noItem;
+
+  WidgetListView::WidgetListView(int posX, int posY, int width, int height, int rowHeight, int rowSpacing)
+    : WidgetContainer(posX, posY, width, height)
+    , m_itemCount(0)
+    , m_rowHeight(std::max(rowHeight, 1))
+    , m_rowSpacing(std::max(rowSpacing, 0))
+    , m_scrollOffset(0.0f)
+    , m_targetOffset(0.0f)
+    , m_scrollVelocity(0.0f)
+    , m_wheelStep(static_cast<float>(m_rowHeight + m_rowSpacing))
+  {
+    // Rows scrolled partly out of the list are cut at its edges
+    SetClipChildren(true);
+  }
+
+  WidgetListView::~WidgetListView() = default;
+
+  InputEventState WidgetListView::ProcessInput(const InputEvent& event)
+  {
+    if (!IsVisible())
+      return InputEventState::Unhandled;
+
+    if (event.type == InputEvent::MouseWheelScrolled
+      && event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel
+      && ContainsPoint(event.mouseWheelScroll.x, event.mouseWheelScroll.y))
+    {
+      ScrollBy(-event.mouseWheelScroll.delta * m_wheelStep);
+      return InputEventState::Handled;
+    }
+
+    return WidgetContainer::ProcessInput(event);
+  }
+
+  void WidgetListView::SetRowFactory(RowFactory factory)
+  {
+    m_rowFactory = std::move(factory);
+    ClearWidgets();
+    m_rows.clear();
+    m_slotItems.clear();
+    if (!m_rowFactory)
+    {
+      return;
+    }
+
+    // Enough rows to cover the list while one row is half scrolled out at each edge
+    int stride = GetRowStride();
+    size_t slotCount = static_cast<size_t>((GetHeight() + stride - 1) / stride + 1);
+    for (size_t slot = 0; slot < slotCount; ++slot)
+    {
+      WidgetPtr row = m_rowFactory(slot);
+      if (!row)
+      {
+        break;
+      }
+      row->SetVisible(false);
+      m_rows.push_back(row.get());
+      m_slotItems.push_back(s_noItem);
+      AddWidget(std::move(row));
+    }
+    ApplyScroll(true);
+  }
+
+  void WidgetListView::SetRowBinder(RowBinder binder)
+  {
+    m_rowBinder = std::move(binder);
+    ApplyScroll(true);
+  }
+
+  size_t WidgetListView::GetSlotCount() const
+  {
+    return m_rows.size();
+  }
+
+  size_t WidgetListView::GetSlotItem(size_t slot) const
+  {
+    return slot < m_slotItems.size() ? m_slotItems[slot] : s_noItem;
+  }
+
+  void WidgetListView::SetItemCount(size_t itemCount)
+  {
+    m_itemCount = itemCount;
+    m_targetOffset = std::min(m_targetOffset, GetMaxScrollOffset());
+    m_scrollOffset = std::min(m_scrollOffset, GetMaxScrollOffset());
+    ApplyScroll(true);
+  }
+
+  size_t WidgetListView::GetItemCount() const
+  {
+    return m_itemCount;
+  }
+
+  void WidgetListView::RefreshRows()
+  {
+    ApplyScroll(true);
+  }
+
+  void WidgetListView::ScrollBy(float pixels)
+  {
+    m_targetOffset = std::max(0.0f, std::min(m_targetOffset + pixels, GetMaxScrollOffset()));
+  }
+
+  void WidgetListView::ScrollToItem(size_t itemIndex)
+  {
+    if (itemIndex >= m_itemCount)
+    {
+      return;
+    }
+
+    float itemTop = static_cast<float>(itemIndex) * GetRowStride();
+    float itemBottom = itemTop + m_rowHeight;
+    if (itemTop < m_targetOffset)
+    {
+      m_targetOffset = itemTop;
+    }
+    else if (itemBottom > m_targetOffset + GetHeight())
+    {
+      m_targetOffset = itemBottom - GetHeight();
+    }
+    m_targetOffset = std::max(0.0f, std::min(m_targetOffset, GetMaxScrollOffset()));
+  }
+
+  void WidgetListView::SetScrollVelocity(float pixelsPerSecond)
+  {
+    m_scrollVelocity = pixelsPerSecond;
+  }
+
+  void WidgetListView::SetWheelStep(float pixels)
+  {
+    m_wheelStep = pixels;
+  }
+
+  void WidgetListView::Update(sf::Time delta)
+  {
+    float seconds = delta.asSeconds();
+    if (m_scrollVelocity != 0.0f)
+    {
+      ScrollBy(m_scrollVelocity * seconds);
+    }
+
+    if (m_scrollOffset == m_targetOffset)
+    {
+      return;
+    }
+
+    // Ease towards the target; snap when less than half a pixel is left
+    float remaining = m_targetOffset - m_scrollOffset;
+    if (std::abs(remaining) < 0.5f)
+    {
+      m_scrollOffset = m_targetOffset;
+    }
+    else
+    {
+      m_scrollOffset += remaining * std::min(1.0f, seconds * s_scrollEaseRate);
+    }
+    ApplyScroll(false);
+  }
+
+  float WidgetListView::GetScrollOffset() const
+  {
+    return m_scrollOffset;
+  }
+
+  float WidgetListView::GetMaxScrollOffset() const
+  {
+    float contentHeight = static_cast<float>(m_itemCount) * GetRowStride() - m_rowSpacing;
+    return std::max(0.0f, contentHeight - GetHeight());
+  }
+
+  void WidgetListView::ApplyScroll(bool rebindAll)
+  {
+    if (m_rows.empty())
+    {
+      return;
+    }
+
+    // Rows are placed from the list's current position; apply a pending move of the list first
+    // so it is not added on top
+    UpdateLayout();
+
+    int stride = GetRowStride();
+    size_t slotCount = m_rows.size();
+    size_t firstItem = static_cast<size_t>(m_scrollOffset / stride);
+    int scrollPixels = static_cast<int>(std::floor(m_scrollOffset));
+
+    for (size_t slot = 0; slot < slotCount; ++slot)
+    {
+      // The item of this slot among the slotCount items starting at firstItem
+      size_t item = firstItem + (slot + slotCount - firstItem % slotCount) % slotCount;
+      Widget* row = m_rows[slot];
+
+      if (item >= m_itemCount)
+      {
+        m_slotItems[slot] = s_noItem;
+        row->SetVisible(false);
+        continue;
+      }
+
+      int rowY = GetPosAbsY() + static_cast<int>(item) * stride - scrollPixels;
+      row->Translate(0, rowY - row->GetPosAbsY());
+      row->SetVisible(true);
+
+      if (rebindAll || m_slotItems[slot] != item)
+      {
+        m_slotItems[slot] = item;
+        if (m_rowBinder)
+        {
+          m_rowBinder(slot, item);
+        }
+      }
+    }
+  }
+
+  int WidgetListView::GetRowStride() const
+  {
+    return m_rowHeight + m_rowSpacing;
+  }
+
+  bool WidgetListView::ContainsPoint(int x, int y) const
+  {
+    return x >= GetPosAbsX() && x <= GetPosAbsX() + GetWidth()
+      && y >= GetPosAbsY() && y <= GetPosAbsY() + GetHeight();
+  }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "WidgetContainer.h"
+#include <functional>
+#include <vector>
+
+namespace ui
+{
+  // Vertical list over any number of items that only keeps the rows that fit on screen.
+  // The rows are created once by the row factory and rebound to other items while scrolling,
+  // so the cost of a frame depends on the list height, not on the item count.
+  // Item i always lives in pool slot i % slot count; scrolling by one row rebinds one slot.
+  class WidgetListView : public WidgetContainer
+  {
+  public:
+    using RowFactory = std::function<WidgetPtr(size_t slot)>;              // Creates the row of a pool slot
+    using RowBinder = std::function<void(size_t slot, size_t itemIndex)>;  // Shows an item in a pool slot
+
+    static const size_t s_noItem = static_cast<size_t>(-1);
+
+    WidgetListView(int posX, int posY, int width, int height, int rowHeight, int rowSpacing = 0);
+    virtual ~WidgetListView();
+
+    // Widget interface implementation
+    virtual InputEventState ProcessInput(const InputEvent& event) override;
+
+    // Rows are created as soon as the factory is set; the binder is called for every
+    // slot that gets a new item
+    void SetRowFactory(RowFactory factory);
+    void SetRowBinder(RowBinder binder);
+    size_t GetSlotCount() const;
+    size_t GetSlotItem(size_t slot) const;  // Item shown in a slot, s_noItem if the slot is hidden
+
+    // Item data; both rebind the visible rows and keep the scroll position where possible
+    void SetItemCount(size_t itemCount);
+    size_t GetItemCount() const;
+    void RefreshRows();
+
+    // Scrolling in pixels. Wheel steps and ScrollBy move a target that Update eases towards;
+    // the velocity moves the target continuously (analog stick)
+    void ScrollBy(float pixels);
+    void ScrollToItem(size_t itemIndex);
+    void SetScrollVelocity(float pixelsPerSecond);
+    void SetWheelStep(float pixels);
+    void Update(sf::Time delta);
+    float GetScrollOffset() const;
+    float GetMaxScrollOffset() const;
+
+  private:
+    void ApplyScroll(bool rebindAll);
+    int GetRowStride() const;
+    bool ContainsPoint(int x, int y) const;
+
+    RowFactory m_rowFactory;
+    RowBinder m_rowBinder;
+    std::vector<Widget*> m_rows;        // Slot -> row widget (owned as a child)
+    std::vector<size_t> m_slotItems;    // Slot -> bound item, s_noItem if hidden
+    size_t m_itemCount;
+    int m_rowHeight;
+    int m_rowSpacing;
+    float m_scrollOffset;               // Pixels scrolled past the top of the first item
+    float m_targetOffset;               // Offset the scrolling eases towards
+    float m_scrollVelocity;             // Pixels per second
+    float m_wheelStep;                  // Pixels per wheel notch
+  };
+}
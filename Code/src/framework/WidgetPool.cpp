@@ -0,0 +1,94 @@
+#include "pch.h"
+#include "WidgetPool.h"
+#include <new>
+
+namespace ui
+{
+  WidgetPool& WidgetPool::Get()
+  {
+    static WidgetPool s_pool;
+    return s_pool;
+  }
+
+  WidgetPool::WidgetPool()
+    : m_sizeClasses(s_maxSlotSize / s_granularity)
+  {
+    for (size_t index = 0; index < m_sizeClasses.size(); ++index)
+    {
+      m_sizeClasses[index].m_slotSize = (index + 1) * s_granularity;
+    }
+  }
+
+  void* WidgetPool::Allocate(size_t size)
+  {
+    WidgetPool& pool = Get();
+    if (size == 0 || size > s_maxSlotSize)
+    {
+      ++pool.m_stats.m_oversized;
+      return ::operator new(size);
+    }
+
+    SizeClass& sizeClass = pool.m_sizeClasses[GetSizeClassIndex(size)];
+    if (sizeClass.m_freeList == nullptr)
+    {
+      pool.AddChunk(sizeClass);
+    }
+
+    void* slot = sizeClass.m_freeList;
+    sizeClass.m_freeList = *static_cast<void**>(slot);
+    ++pool.m_stats.m_liveWidgets;
+    return slot;
+  }
+
+  void WidgetPool::Free(void* memory, size_t size)
+  {
+    if (memory == nullptr)
+    {
+      return;
+    }
+
+    WidgetPool& pool = Get();
+    if (size == 0 || size > s_maxSlotSize)
+    {
+      --pool.m_stats.m_oversized;
+      ::operator delete(memory);
+      return;
+    }
+
+    SizeClass& sizeClass = pool.m_sizeClasses[GetSizeClassIndex(size)];
+    *static_cast<void**>(memory) = sizeClass.m_freeList;
+    sizeClass.m_freeList = memory;
+    --pool.m_stats.m_liveWidgets;
+  }
+
+  WidgetPool::Stats WidgetPool::GetStats()
+  {
+    return Get().m_stats;
+  }
+
+  size_t WidgetPool::GetSizeClassIndex(size_t size)
+  {
+    return (size + s_granularity - 1) / s_granularity - 1;
+  }
+
+  void WidgetPool::AddChunk(SizeClass& sizeClass)
+  {
+    // new[] of unsigned char is aligned for any fundamental type; slot sizes are multiples of
+    // s_granularity, so every slot keeps that alignment
+    size_t chunkBytes = sizeClass.m_slotSize * s_slotsPerChunk;
+    std::unique_ptr<unsigned char[]> chunk(new unsigned char[chunkBytes]);
+
+    // Thread the new slots onto the free list in address order
+    unsigned char* first = chunk.get();
+    for (size_t slot = 0; slot < s_slotsPerChunk; ++slot)
+    {
+      void* next = slot + 1 < s_slotsPerChunk ? first + (slot + 1) * sizeClass.m_slotSize : sizeClass.m_freeList;
+      *reinterpret_cast<void**>(first + slot * sizeClass.m_slotSize) = next;
+    }
+    sizeClass.m_freeList = first;
+
+    sizeClass.m_chunks.push_back(std::move(chunk));
+    ++m_stats.m_chunkCount;
+    m_stats.m_reservedBytes += chunkBytes;
+  }
+}
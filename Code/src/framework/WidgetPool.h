@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ui
+{
+  // Storage behind Widget::operator new. Widgets are placed in chunks of equally sized slots,
+  // one pool per 16-byte size class, so building the tree does not go to the general heap once
+  // per widget. Pools are keyed by size, not by type: widgets of different types whose sizes
+  // round to the same class share a pool and are interleaved in allocation order.
+  // Freed slots are reused by the next widget of the same size class and chunks are kept until
+  // exit; there are no handles, widgets are still owned through unique_ptr. Main thread only.
+  class WidgetPool
+  {
+  public:
+    struct Stats
+    {
+      size_t m_liveWidgets = 0;     // Slots currently in use
+      size_t m_chunkCount = 0;      // Chunks allocated over all size classes
+      size_t m_reservedBytes = 0;   // Memory held by the chunks
+      size_t m_oversized = 0;       // Live widgets too large for a size class (plain heap)
+    };
+
+    static void* Allocate(size_t size);
+    static void Free(void* memory, size_t size);
+    static Stats GetStats();
+
+  private:
+    struct SizeClass
+    {
+      std::vector<std::unique_ptr<unsigned char[]>> m_chunks;
+      void* m_freeList = nullptr;   // Freed slots, each holding the pointer to the next one
+      size_t m_slotSize = 0;
+    };
+
+    static WidgetPool& Get();
+    WidgetPool();
+
+    static size_t GetSizeClassIndex(size_t size);
+    void AddChunk(SizeClass& sizeClass);
+
+    std::vector<SizeClass> m_sizeClasses;
+    Stats m_stats;
+
+    static constexpr size_t s_granularity = 16;       // Slot sizes are multiples of this
+    static constexpr size_t s_maxSlotSize = 4096;     // Larger widgets use the plain heap
+    static constexpr size_t s_slotsPerChunk = 32;
+  };
+}
@@ -0,0 +1,159 @@
+#include "pch.h"
+#include "WidgetProfilerHud.h"
+#include "WidgetText.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace ui
+{
+  WidgetProfilerHud::WidgetProfilerHud(int posX, int posY)
+    : Widget(posX, posY, 0, 0)
+    , m_renderContext(nullptr)
+    , m_sinceRefresh(sf::seconds(s_refreshSeconds))
+  {
+    const sf::Font* font = WidgetText::GetDefaultFont();
+    for (sf::Text* text : { &m_columns[Name], &m_columns[Last], &m_columns[Min], &m_columns[Avg], &m_columns[P99], &m_columns[Calls], &m_renderStatsText })
+    {
+      if (font)
+      {
+        text->setFont(*font);
+      }
+      text->setCharacterSize(14);
+      text->setFillColor(sf::Color(120, 255, 120));
+    }
+    m_background.setFillColor(sf::Color(0, 0, 0, 190));
+    UpdatePosition();
+  }
+
+  WidgetProfilerHud::~WidgetProfilerHud() = default;
+
+  InputEventState WidgetProfilerHud::ProcessInput(const InputEvent& /*event*/)
+  {
+    return InputEventState::Unhandled;
+  }
+
+  void WidgetProfilerHud::Draw(RenderContext& context) const
+  {
+    if (!IsVisible() || m_columns[Name].getFont() == nullptr)
+      return;
+
+    context.draw(m_background);
+    for (const sf::Text& column : m_columns)
+    {
+      context.draw(column);
+    }
+    context.draw(m_renderStatsText);
+  }
+
+  void WidgetProfilerHud::SetRenderContext(const RenderContext* context)
+  {
+    m_renderContext = context;
+  }
+
+  void WidgetProfilerHud::UpdatePosition()
+  {
+    float posX = static_cast<float>(GetPosAbsX() + s_padding);
+    float posY = static_cast<float>(GetPosAbsY() + s_padding);
+    m_background.setPosition(static_cast<float>(GetPosAbsX()), static_cast<float>(GetPosAbsY()));
+    for (int column = 0; column < ColumnCount; ++column)
+    {
+      float columnX = column == Name ? 0.0f : static_cast<float>(s_nameColumnWidth + (column - 1) * s_valueColumnWidth);
+      m_columns[column].setPosition(posX + columnX, posY);
+    }
+  }
+
+  void WidgetProfilerHud::Update(sf::Time delta)
+  {
+    if (!IsVisible())
+      return;
+
+    m_sinceRefresh += delta;
+    if (m_sinceRefresh.asSeconds() < s_refreshSeconds)
+      return;
+
+    m_sinceRefresh = sf::Time::Zero;
+    RebuildText();
+  }
+
+  void WidgetProfilerHud::RebuildText()
+  {
+    MEMORY_TAG_SCOPE(MemoryTag::UI, "WidgetProfilerHud::RebuildText");
+    const Profiler& profiler = Profiler::Get();
+    std::string columns[ColumnCount] = { "Scope\n", "last\n", "min\n", "avg\n", "p99\n", "calls\n" };
+    char value[32];
+    auto appendMs = [&value](std::string& column, float ms)
+    {
+      std::snprintf(value, sizeof(value), "%.2f\n", ms);
+      column += value;
+    };
+
+    float minMs, avgMs, p99Ms;
+    float frameMs = profiler.GetFrameMs(minMs, avgMs, p99Ms);
+    columns[Name] += "Frame\n";
+    appendMs(columns[Last], frameMs);
+    appendMs(columns[Min], minMs);
+    appendMs(columns[Avg], avgMs);
+    appendMs(columns[P99], p99Ms);
+    columns[Calls] += "\n";
+
+    profiler.GetStats(m_stats);
+    for (const Profiler::NodeStats& stats : m_stats)
+    {
+      // Indent by depth so the tree shape shows
+      columns[Name] += std::string(static_cast<size_t>(stats.m_depth + 1) * 2, ' ') + stats.m_name + "\n";
+      appendMs(columns[Last], stats.m_lastMs);
+      appendMs(columns[Min], stats.m_minMs);
+      appendMs(columns[Avg], stats.m_avgMs);
+      appendMs(columns[P99], stats.m_p99Ms);
+      columns[Calls] += std::to_string(stats.m_calls) + "\n";
+    }
+
+    for (int column = 0; column < ColumnCount; ++column)
+    {
+      m_columns[column].setString(columns[column]);
+    }
+
+    // Draw statistics of the last finished frame, below the table
+    std::string renderStats;
+    if (m_renderContext)
+    {
+      const RenderStats& stats = m_renderContext->GetLastFrameStats();
+      renderStats = "Draw calls " + std::to_string(stats.m_drawCalls) + "   vertices " + std::to_string(stats.m_vertices)
+        + "   texture changes " + std::to_string(stats.m_textureChanges) + "   shader " + std::to_string(stats.m_shaderChanges)
+        + "   blend " + std::to_string(stats.m_blendChanges) + "\n";
+      for (const RenderStats::TypeStats& typeStats : stats.m_types)
+      {
+        renderStats += "  " + std::string(typeStats.m_typeName) + "   " + std::to_string(typeStats.m_drawCalls)
+          + " calls   " + std::to_string(typeStats.m_vertices) + " vertices\n";
+      }
+    }
+
+    // Heap activity of the last finished frame, when the build tracks allocations
+    if (MemoryTracker::IsEnabled())
+    {
+      const MemoryTracker& tracker = MemoryTracker::Get();
+      MemoryTracker::TagStats total = tracker.GetTotalStats();
+      std::snprintf(value, sizeof(value), "%.1f", static_cast<double>(total.m_frameBytes) / 1024.0);
+      renderStats += "Allocations " + std::to_string(total.m_frameAllocations) + "   " + value + " KB";
+      std::snprintf(value, sizeof(value), "%.2f", static_cast<double>(total.m_liveBytes) / (1024.0 * 1024.0));
+      renderStats += "   live " + std::string(value) + " MB   no-alloc violations " + std::to_string(tracker.GetNoAllocViolations()) + "\n";
+      for (int tag = 0; tag < static_cast<int>(MemoryTag::MAX); ++tag)
+      {
+        MemoryTracker::TagStats stats = tracker.GetTagStats(static_cast<MemoryTag>(tag));
+        std::snprintf(value, sizeof(value), "%.2f", static_cast<double>(stats.m_liveBytes) / (1024.0 * 1024.0));
+        renderStats += "  " + std::string(MemoryTracker::GetTagName(static_cast<MemoryTag>(tag))) + "   "
+          + std::to_string(stats.m_frameAllocations) + " allocs   live " + value + " MB\n";
+      }
+    }
+    m_renderStatsText.setString(renderStats);
+
+    sf::FloatRect tableBounds = m_columns[Name].getLocalBounds();
+    int tableHeight = static_cast<int>(tableBounds.top + tableBounds.height);
+    m_renderStatsText.setPosition(static_cast<float>(GetPosAbsX() + s_padding), static_cast<float>(GetPosAbsY() + 2 * s_padding + tableHeight));
+
+    sf::FloatRect statsBounds = m_renderStatsText.getLocalBounds();
+    SetWidth(std::max(s_nameColumnWidth + (ColumnCount - 1) * s_valueColumnWidth, static_cast<int>(statsBounds.left + statsBounds.width)) + 2 * s_padding);
+    SetHeight(tableHeight + static_cast<int>(statsBounds.top + statsBounds.height) + 3 * s_padding);
+    m_background.setSize(sf::Vector2f(static_cast<float>(GetWidth()), static_cast<float>(GetHeight())));
+  }
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "widget.h"
+#include "../core/profiler.h"
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+namespace ui
+{
+  // Overlay listing the profiler tree: per scope the last frame time and min/avg/p99 over the
+  // profiler history, followed by the draw statistics of the render context and, in builds with
+  // MEMORY_TRACKING_ENABLED, the allocations per subsystem. The text is rebuilt
+  // a few times per second, not every frame, so showing the overlay costs a few draws per frame.
+  class WidgetProfilerHud : public Widget
+  {
+  public:
+    WidgetProfilerHud(int posX, int posY);
+    virtual ~WidgetProfilerHud();
+
+    // Widget interface implementation
+    virtual InputEventState ProcessInput(const InputEvent& event) override;
+    virtual void Draw(RenderContext& context) const override;
+    virtual void UpdatePosition() override;
+
+    void Update(sf::Time delta);
+    void SetRenderContext(const RenderContext* context); // Source of the draw statistics
+
+  private:
+    void RebuildText();
+
+    // One text per column: the font is proportional, so columns are placed, not padded
+    enum Column { Name, Last, Min, Avg, P99, Calls, ColumnCount };
+
+    sf::RectangleShape m_background;
+    sf::Text m_columns[ColumnCount];
+    sf::Text m_renderStatsText;
+    const RenderContext* m_renderContext;
+    sf::Time m_sinceRefresh;
+    std::vector<Profiler::NodeStats> m_stats;
+
+    static constexpr float s_refreshSeconds = 0.25f;
+    static constexpr int s_padding = 8;
+    static constexpr int s_nameColumnWidth = 260;
+    static constexpr int s_valueColumnWidth = 70;
+  };
+}
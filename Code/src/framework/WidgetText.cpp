@@ -15,12 +15,9 @@ namespace ui
     , m_currentAlpha(255.0f)
     , m_originalColor(sf::Color::White)
   {
-    std::string fullPath = Application::s_assetsPath + "FontBasic.ttf";
-
-    // LoadStockProducts default font from assets
-    if (m_defaultFont.loadFromFile(fullPath))
+    if (const sf::Font* defaultFont = GetDefaultFont())
     {
-      m_text.setFont(m_defaultFont);
+      m_text.setFont(*defaultFont);
     }
 
     // Set default text properties
@@ -35,6 +32,19 @@ namespace ui
 
   WidgetText::~WidgetText() = default;
 
+  const sf::Font* WidgetText::GetDefaultFont()
+  {
+    // Loaded from the assets once and shared by all text widgets, so they also share one glyph cache
+    static sf::Font s_defaultFont;
+    static const bool s_loaded = []()
+    {
+      std::string path = Application::s_assetsPath + "FontBasic.ttf";
+      StartupAssetScope asset(path, StartupAssetKind::Font);
+      return asset.Complete(s_defaultFont.loadFromFile(path));
+    }();
+    return s_loaded ? &s_defaultFont : nullptr;
+  }
+
   InputEventState WidgetText::ProcessInput(const InputEvent& event)
   {
     // Text widgets typically don't handle input events
@@ -44,13 +54,19 @@ namespace ui
 
   void WidgetText::Draw(RenderContext& context) const
   {
-    // Only draw if we have a valid font and widget is visible
-    if (m_text.getFont() != nullptr && IsVisible())
+    // Only draw if we have a valid font and widget is visible (faded out counts as hidden)
+    if (m_text.getFont() != nullptr && IsVisible() && m_text.getFillColor().a > 0)
     {
       context.draw(m_text);
     }
   }
 
+  bool WidgetText::GetDrawBounds(sf::FloatRect& bounds) const
+  {
+    bounds = m_text.getGlobalBounds();
+    return true;
+  }
+
   void WidgetText::Update(float deltaTime)
   {
     if (m_fadingEnabled)
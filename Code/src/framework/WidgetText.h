@@ -12,9 +12,12 @@ namespace ui
     WidgetText(int posX, int posY, const std::string& text = "");
     virtual ~WidgetText();
 
+    static const sf::Font* GetDefaultFont(); // Null if the font file is missing
+
     // Widget interface implementation
     virtual InputEventState ProcessInput(const InputEvent& event) override;
     virtual void Draw(RenderContext& context) const override;
+    virtual bool GetDrawBounds(sf::FloatRect& bounds) const override; // Glyph bounds, alignment applied
     virtual void Update(float deltaTime);
 
     // Text specific methods
@@ -57,7 +60,6 @@ namespace ui
 
   private:
     sf::Text m_text;
-    sf::Font m_defaultFont;
     bool m_hasCustomFont;
     Alignment m_alignment;
     std::string m_textString;
@@ -1,5 +1,8 @@
 #include "pch.h"
 #include "widget.h"
+#include "WidgetContainer.h"
+#include "WidgetHitGrid.h"
+#include "WidgetPool.h"
 
 namespace ui
 {
@@ -16,6 +19,16 @@ namespace ui
 
   Widget::~Widget() = default;
 
+  void* Widget::operator new(size_t size)
+  {
+    return WidgetPool::Allocate(size);
+  }
+
+  void Widget::operator delete(void* memory, size_t size)
+  {
+    WidgetPool::Free(memory, size);
+  }
+
   int Widget::GetPosRelX() const
   {
     return m_posRelX;
@@ -59,21 +72,33 @@ namespace ui
   void Widget::SetPosAbsX(int posAbsX)
   {
     m_posAbsX = posAbsX;
+    NotifyBoundsChanged();
   }
 
   void Widget::SetPosAbsY(int posAbsY)
   {
     m_posAbsY = posAbsY;
+    NotifyBoundsChanged();
   }
 
   void Widget::SetWidth(int width)
   {
     m_width = width;
+    NotifyBoundsChanged();
+    if (m_parent)
+    {
+      m_parent->OnChildResized();
+    }
   }
 
   void Widget::SetHeight(int height)
   {
     m_height = height;
+    NotifyBoundsChanged();
+    if (m_parent)
+    {
+      m_parent->OnChildResized();
+    }
   }
 
   void Widget::SetVisible(bool visible)
@@ -86,4 +111,86 @@ namespace ui
     return m_visible;
   }
 
+  void Widget::Translate(int deltaX, int deltaY)
+  {
+    if (deltaX == 0 && deltaY == 0)
+    {
+      return;
+    }
+
+    SetPosAbsX(m_posAbsX + deltaX);
+    SetPosAbsY(m_posAbsY + deltaY);
+    UpdatePosition();
+  }
+
+  WidgetContainer* Widget::GetParent() const
+  {
+    return m_parent;
+  }
+
+  void Widget::SetParent(WidgetContainer* parent)
+  {
+    m_parent = parent;
+  }
+
+  bool Widget::IsVisibleInTree() const
+  {
+    for (const Widget* widget = this; widget; widget = widget->m_parent)
+    {
+      if (!widget->m_visible)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool Widget::GetDrawBounds(sf::FloatRect& bounds) const
+  {
+    bounds = sf::FloatRect(static_cast<float>(m_posAbsX), static_cast<float>(m_posAbsY),
+      static_cast<float>(m_width), static_cast<float>(m_height));
+    return true;
+  }
+
+  bool Widget::IsPointClipped(int x, int y) const
+  {
+    for (const WidgetContainer* container = m_parent; container; container = container->GetParent())
+    {
+      if (container->IsClippingChildren()
+        && (x < container->GetPosAbsX() || x > container->GetPosAbsX() + container->GetWidth()
+          || y < container->GetPosAbsY() || y > container->GetPosAbsY() + container->GetHeight()))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Widget::CollectPointerTargets(std::vector<Widget*>& targets)
+  {
+    if (IsPointerTarget())
+    {
+      targets.push_back(this);
+    }
+  }
+
+  void Widget::NotifyBoundsChanged()
+  {
+    // Widgets not added to a container yet are indexed when the grid is rebuilt
+    if (!m_parent || !IsPointerTarget())
+    {
+      return;
+    }
+
+    WidgetContainer* root = m_parent;
+    while (root->GetParent())
+    {
+      root = root->GetParent();
+    }
+    if (WidgetHitGrid* hitGrid = root->GetHitGrid())
+    {
+      hitGrid->MarkMoved(this);
+    }
+  }
+
 }
@@ -1,15 +1,23 @@
 #pragma once
 #include "pch.h"
 #include <memory>
+#include <vector>
 
 namespace ui
 {
+  class WidgetContainer;
+
   class Widget
   {
   public:
     Widget( int posX, int posY, int width, int height );
     virtual ~Widget();
 
+    // Widgets live in WidgetPool size-class slots (see WidgetPool.h); the virtual destructor
+    // passes the size of the most derived type to delete
+    static void* operator new(size_t size);
+    static void operator delete(void* memory, size_t size);
+
     virtual InputEventState ProcessInput( const InputEvent& event ) = 0;
     virtual void Draw( RenderContext& context ) const = 0;
 
@@ -36,9 +44,36 @@ namespace ui
     // Position update notification - called after position changes
     virtual void UpdatePosition() {}
 
+    // Moves the absolute position (containers move their children along)
+    virtual void Translate(int deltaX, int deltaY);
+
+    // Pending layout of this subtree (containers only, see WidgetContainer::UpdateLayout)
+    virtual bool IsLayoutDirty() const { return false; }
+    virtual void UpdateLayout() {}
+    virtual void MeasureLayout() {} // First pass of UpdateLayout, children before their parents
+    virtual void ArrangeLayout() {} // Second pass, parents before their children
+
+    // Hierarchy (parent is set by WidgetContainer::AddWidget)
+    WidgetContainer* GetParent() const;
+    void SetParent(WidgetContainer* parent);
+    bool IsVisibleInTree() const; // Visible together with all parent containers
+
+    // Culling. The draw bounds are the absolute rectangle the widget draws into; false means
+    // they are not known up front and the widget is always drawn.
+    virtual bool GetDrawBounds(sf::FloatRect& bounds) const;
+    bool IsPointClipped(int x, int y) const; // Cut away by a clipping parent container
+
+    // Widgets that react to pointer events; only these are indexed by the root container's hit grid
+    virtual bool IsPointerTarget() const { return false; }
+    // Appends this widget (or, for containers, its descendants) in draw order
+    virtual void CollectPointerTargets(std::vector<Widget*>& targets);
+
   protected:
+    // Tells the hit grid that the absolute rectangle changed
+    void NotifyBoundsChanged();
 
   private:
+    WidgetContainer* m_parent = nullptr;
     int m_posRelX;   // Relative position within parent container
     int m_posRelY;   // Relative position within parent container
     int m_posAbsX;   // Absolute position on screen
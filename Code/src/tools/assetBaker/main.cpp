@@ -0,0 +1,209 @@
+#include "pch.h"
+#include "../../framework/ImageResampler.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/prettywriter.h"
+#include <iostream>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+// Offline asset baker.
+// Reads data/asset_manifest.json, resamples every listed texture to the largest size
+// the UI draws it at and writes the results plus asset_bake_report.json to the output
+// folder. The application reads the report at startup and prefers baked textures.
+//
+// Usage: assetBaker [manifest] [sourceAssetsDir] [outputDir]
+
+namespace
+{
+	struct BakeEntry
+	{
+		std::string m_file;        ///< Texture file name relative to the assets folder
+		unsigned int m_width;      ///< Largest on-screen width
+		unsigned int m_height;     ///< Largest on-screen height
+	};
+
+	/// @brief Reads a whole file into a string
+	/// @param path File to read
+	/// @param content Receives the file content
+	/// @return True if the file could be opened
+	bool ReadTextFile(const std::string& path, std::string& content)
+	{
+		std::ifstream stream(path, std::ios::binary);
+		if (!stream.is_open())
+		{
+			return false;
+		}
+		content.assign((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+		return true;
+	}
+
+	/// @brief Creates a directory if it does not exist yet
+	/// @param path Directory path
+	/// @return True if the directory exists afterwards
+	bool CreateDirectoryIfMissing(const std::string& path)
+	{
+		struct stat info;
+		if (stat(path.c_str(), &info) == 0)
+		{
+			return (info.st_mode & S_IFDIR) != 0;
+		}
+#ifdef _WIN32
+		return _mkdir(path.c_str()) == 0;
+#else
+		return mkdir(path.c_str(), 0755) == 0;
+#endif
+	}
+
+	/// @brief Reads a positive size field of a manifest entry
+	/// @param texture Manifest entry
+	/// @param name Field name
+	/// @param value Receives the size
+	/// @return False if the field is missing or not a positive integer
+	bool ReadManifestSize(const Json::Value& texture, const char* name, unsigned int& value)
+	{
+		if (!texture.HasMember(name) || !texture[name].IsUint() || texture[name].GetUint() == 0)
+		{
+			return false;
+		}
+		value = texture[name].GetUint();
+		return true;
+	}
+
+	/// @brief Parses the asset manifest
+	/// @param path Manifest file path
+	/// @param entries Receives one entry per texture to bake
+	/// @return True if the manifest was read and parsed
+	/// Entries with a missing or mistyped field are reported and skipped
+	bool LoadManifest(const std::string& path, std::vector<BakeEntry>& entries)
+	{
+		std::string fileData;
+		if (!ReadTextFile(path, fileData))
+		{
+			std::cerr << "Failed to open manifest: " << path << std::endl;
+			return false;
+		}
+
+		Json::Document document;
+		document.Parse(fileData.c_str());
+		if (document.HasParseError() || !document.IsObject() || !document.HasMember("textures") || !document["textures"].IsArray())
+		{
+			std::cerr << "Invalid manifest: " << path << std::endl;
+			return false;
+		}
+
+		const Json::Value& textures = document["textures"];
+		for (Json::SizeType i = 0; i < textures.Size(); i++)
+		{
+			const Json::Value& texture = textures[i];
+			if (!texture.IsObject())
+			{
+				std::cerr << "Skipping manifest entry " << i << ": not an object" << std::endl;
+				continue;
+			}
+			if (!texture.HasMember("file") || !texture["file"].IsString() || texture["file"].GetStringLength() == 0)
+			{
+				std::cerr << "Skipping manifest entry " << i << ": \"file\" must be a non-empty string" << std::endl;
+				continue;
+			}
+
+			BakeEntry entry;
+			entry.m_file = texture["file"].GetString();
+			if (!ReadManifestSize(texture, "width", entry.m_width) || !ReadManifestSize(texture, "height", entry.m_height))
+			{
+				std::cerr << "Skipping manifest entry " << i << " (" << entry.m_file << "): \"width\" and \"height\" must be positive integers" << std::endl;
+				continue;
+			}
+			entries.push_back(entry);
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	// Defaults match the layout used when running from the project directory
+	std::string manifestPath = (argc > 1) ? argv[1] : "../../../data/asset_manifest.json";
+	std::string sourceDir = (argc > 2) ? argv[2] : "../../../assets/";
+	std::string outputDir = (argc > 3) ? argv[3] : "../../../assets_baked/";
+
+	std::vector<BakeEntry> entries;
+	if (!LoadManifest(manifestPath, entries))
+	{
+		return 1;
+	}
+
+	if (!CreateDirectoryIfMissing(outputDir))
+	{
+		std::cerr << "Failed to create output directory: " << outputDir << std::endl;
+		return 1;
+	}
+
+	Json::StringBuffer reportBuffer;
+	Json::PrettyWriter<Json::StringBuffer> report(reportBuffer);
+	report.StartObject();
+	report.Key("textures");
+	report.StartArray();
+
+	int failures = 0;
+	uint64_t sourceBytes = 0;
+	uint64_t bakedBytes = 0;
+
+	for (const BakeEntry& entry : entries)
+	{
+		sf::Image source;
+		if (!source.loadFromFile(sourceDir + entry.m_file))
+		{
+			std::cerr << "Failed to load " << entry.m_file << std::endl;
+			++failures;
+			continue;
+		}
+
+		// Never upscale: a texture already at or below its draw size is left to the original
+		sf::Vector2u sourceSize = source.getSize();
+		unsigned int width = std::min(entry.m_width, sourceSize.x);
+		unsigned int height = std::min(entry.m_height, sourceSize.y);
+		if (width == sourceSize.x && height == sourceSize.y)
+		{
+			std::cout << entry.m_file << ": already " << width << "x" << height << ", skipped" << std::endl;
+			continue;
+		}
+
+		sf::Image baked = ui::ResampleImage(source, width, height);
+		if (!baked.saveToFile(outputDir + entry.m_file))
+		{
+			std::cerr << "Failed to write " << outputDir + entry.m_file << std::endl;
+			++failures;
+			continue;
+		}
+
+		// Uploaded texture memory (RGBA8, before mipmaps)
+		sourceBytes += static_cast<uint64_t>(sourceSize.x) * sourceSize.y * 4;
+		bakedBytes += static_cast<uint64_t>(width) * height * 4;
+
+		std::cout << entry.m_file << ": " << sourceSize.x << "x" << sourceSize.y << " -> " << width << "x" << height << std::endl;
+
+		report.StartObject();
+		report.Key("file");
+		report.String(entry.m_file.c_str());
+		report.Key("sourceWidth");
+		report.Uint(sourceSize.x);
+		report.Key("sourceHeight");
+		report.Uint(sourceSize.y);
+		report.Key("width");
+		report.Uint(width);
+		report.Key("height");
+		report.Uint(height);
+		report.EndObject();
+	}
+
+	report.EndArray();
+	report.EndObject();
+
+	std::ofstream reportFile(outputDir + "asset_bake_report.json");
+	reportFile << reportBuffer.GetString() << std::endl;
+
+	std::cout << "Texture memory: " << sourceBytes / 1024 << " KB -> " << bakedBytes / 1024 << " KB" << std::endl;
+	return failures == 0 ? 0 : 1;
+}
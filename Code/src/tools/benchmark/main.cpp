@@ -0,0 +1,506 @@
+#include "pch.h"
+#include "../../application/application.h"
+#include "../../application/applicationUI.h"
+#include "../../application/inventory.h"
+#include "../../application/stockMarket.h"
+#include "../../application/utilTools.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/prettywriter.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+// Micro-benchmarks of the market, inventory, JSON loaders and widgets.
+// Every benchmark is warmed up, then timed in samples of a fixed number of iterations
+// (calibrated so one sample takes at least --min-sample-ms) and reported per iteration.
+// The shared random generator is reseeded before each benchmark, so runs are repeatable.
+// Results go to the console and, as JSON, to --output for comparison across releases.
+//
+// Usage: benchmark [--filter=text] [--samples=N] [--min-sample-ms=N] [--output=file]
+//                  [--data=dir] [--assets=dir]
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr uint32_t s_randomSeed = 20240611;
+	constexpr double s_warmupMs = 100.0;
+	constexpr uint64_t s_maxIterationsPerSample = 1ull << 30;
+
+	/// Written by benchmarks whose result would otherwise be unused
+	volatile size_t s_sink = 0;
+
+	struct BenchmarkSettings
+	{
+		std::string m_filter;           ///< Only run benchmarks whose name contains this text
+		uint32_t m_samples = 30;        ///< Timed samples per benchmark
+		double m_minSampleMs = 5.0;     ///< Minimum duration of one sample
+		std::string m_outputPath = "benchmark_results.json";
+		std::string m_dataPath = "../../../data/";
+		std::string m_assetsPath = "../../../assets/";
+	};
+
+	struct Benchmark
+	{
+		std::string m_name;
+		std::function<void()> m_body;   ///< One iteration
+	};
+
+	struct BenchmarkResult
+	{
+		std::string m_name;
+		uint64_t m_iterationsPerSample;
+		uint32_t m_samples;
+		double m_minNs;      ///< Per iteration
+		double m_medianNs;
+		double m_meanNs;
+		double m_p95Ns;
+		double m_maxNs;
+		double m_stddevNs;   ///< Sample standard deviation of the per-sample means
+	};
+
+	/// @brief Reads the value of a --name=value option
+	/// @param argument Command line argument
+	/// @param option Option including the equals sign, e.g. "--samples="
+	/// @param value Receives the text after the equals sign
+	/// @return True if the argument is this option
+	bool ReadOption(const std::string& argument, const char* option, std::string& value)
+	{
+		size_t length = std::strlen(option);
+		if (argument.compare(0, length, option) != 0)
+		{
+			return false;
+		}
+		value = argument.substr(length);
+		return true;
+	}
+
+	/// @brief Parses the command line into settings
+	/// @return False on an unknown option or invalid value
+	bool ParseCommandLine(int argc, char* argv[], BenchmarkSettings& settings)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string argument = argv[i];
+			std::string value;
+			if (ReadOption(argument, "--filter=", value))
+			{
+				settings.m_filter = value;
+			}
+			else if (ReadOption(argument, "--samples=", value))
+			{
+				settings.m_samples = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+				if (settings.m_samples < 2)
+				{
+					std::cerr << "--samples needs at least 2 samples" << std::endl;
+					return false;
+				}
+			}
+			else if (ReadOption(argument, "--min-sample-ms=", value))
+			{
+				settings.m_minSampleMs = std::strtod(value.c_str(), nullptr);
+				if (settings.m_minSampleMs <= 0.0)
+				{
+					std::cerr << "--min-sample-ms must be positive" << std::endl;
+					return false;
+				}
+			}
+			else if (ReadOption(argument, "--output=", value))
+			{
+				settings.m_outputPath = value;
+			}
+			else if (ReadOption(argument, "--data=", value))
+			{
+				settings.m_dataPath = value;
+			}
+			else if (ReadOption(argument, "--assets=", value))
+			{
+				settings.m_assetsPath = value;
+			}
+			else
+			{
+				std::cerr << "Unknown option: " << argument << std::endl;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// @brief Runs a benchmark body a number of times
+	/// @return Elapsed time in nanoseconds
+	double RunIterations(const std::function<void()>& body, uint64_t iterations)
+	{
+		Clock::time_point start = Clock::now();
+		for (uint64_t i = 0; i < iterations; ++i)
+		{
+			body();
+		}
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+	}
+
+	/// @brief Warms up, calibrates and times one benchmark
+	/// @param benchmark Benchmark to run
+	/// @param settings Sample count and duration
+	/// @return Per-iteration statistics over all samples
+	BenchmarkResult RunBenchmark(const Benchmark& benchmark, const BenchmarkSettings& settings)
+	{
+		Application::GetRandomGenerator().seed(s_randomSeed);
+
+		// Grow the batch until one sample is long enough to dwarf the clock resolution;
+		// the calibration batches count towards the warmup
+		const double minSampleNs = settings.m_minSampleMs * 1.0e6;
+		uint64_t iterations = 1;
+		double warmupNs = 0.0;
+		double elapsedNs = RunIterations(benchmark.m_body, iterations);
+		warmupNs += elapsedNs;
+		while (elapsedNs < minSampleNs && iterations < s_maxIterationsPerSample)
+		{
+			iterations *= 2;
+			elapsedNs = RunIterations(benchmark.m_body, iterations);
+			warmupNs += elapsedNs;
+		}
+		while (warmupNs < s_warmupMs * 1.0e6)
+		{
+			warmupNs += RunIterations(benchmark.m_body, iterations);
+		}
+
+		std::vector<double> samples(settings.m_samples);
+		for (double& sample : samples)
+		{
+			sample = RunIterations(benchmark.m_body, iterations) / static_cast<double>(iterations);
+		}
+
+		BenchmarkResult result;
+		result.m_name = benchmark.m_name;
+		result.m_iterationsPerSample = iterations;
+		result.m_samples = settings.m_samples;
+
+		double sum = 0.0;
+		for (double sample : samples)
+		{
+			sum += sample;
+		}
+		result.m_meanNs = sum / static_cast<double>(samples.size());
+
+		double squares = 0.0;
+		for (double sample : samples)
+		{
+			squares += (sample - result.m_meanNs) * (sample - result.m_meanNs);
+		}
+		result.m_stddevNs = std::sqrt(squares / static_cast<double>(samples.size() - 1));
+
+		std::sort(samples.begin(), samples.end());
+		size_t middle = samples.size() / 2;
+		result.m_minNs = samples.front();
+		result.m_maxNs = samples.back();
+		result.m_medianNs = (samples.size() % 2 == 0) ? (samples[middle - 1] + samples[middle]) * 0.5 : samples[middle];
+		result.m_p95Ns = samples[static_cast<size_t>(std::ceil(static_cast<double>(samples.size()) * 0.95)) - 1];
+		return result;
+	}
+
+	/// @brief Writes a product catalog that repeats the products of item_products.json
+	/// @param sourcePath The real item_products.json
+	/// @param outputPath File to write
+	/// @param productCount Number of products in the written catalog; copies get the id suffix "_<n>"
+	/// @return True if the catalog was written
+	bool WriteScaledProductCatalog(const std::string& sourcePath, const std::string& outputPath, uint32_t productCount)
+	{
+		std::ifstream stream(sourcePath, std::ios::binary);
+		if (!stream.is_open())
+		{
+			return false;
+		}
+		std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		Json::Document document;
+		document.Parse(fileData.c_str());
+		if (document.HasParseError() || !document.IsObject() || !document.HasMember("products") || !document["products"].IsArray() || document["products"].Empty())
+		{
+			return false;
+		}
+
+		Json::Document scaled;
+		scaled.SetObject();
+		Json::Document::AllocatorType& allocator = scaled.GetAllocator();
+		Json::Value products(Json::kArrayType);
+		const Json::Value& sourceProducts = document["products"];
+		for (uint32_t i = 0; i < productCount; ++i)
+		{
+			Json::Value product(sourceProducts[i % sourceProducts.Size()], allocator);
+			std::string id = std::string(product["id"].GetString()) + "_" + std::to_string(i);
+			product["id"].SetString(id.c_str(), static_cast<Json::SizeType>(id.size()), allocator);
+			products.PushBack(product, allocator);
+		}
+		scaled.AddMember("products", products, allocator);
+
+		Json::StringBuffer buffer;
+		Json::Writer<Json::StringBuffer> writer(buffer);
+		scaled.Accept(writer);
+
+		std::ofstream output(outputPath, std::ios::binary);
+		output << buffer.GetString();
+		return output.good();
+	}
+
+	/// @brief Creates a market holding productCount products for the cycle benchmarks
+	/// @param baseCount Number of products in item_products.json
+	/// @param productCount Total number of products, at least baseCount
+	/// @return An application of its own owning the market (m_stockMarket), so the market reports
+	///         to its own change bus and leaves the shared one alone; nullptr if the scaled
+	///         catalog could not be written
+	std::unique_ptr<Application> CreateScaledMarket(uint32_t baseCount, uint32_t productCount)
+	{
+		std::unique_ptr<Application> app = std::make_unique<Application>();
+		app->m_stockMarket = std::make_unique<StockMarket>();
+		StockMarket* market = app->m_stockMarket.get();
+		market->m_dataHotReload = false;
+		market->InitializeStockMarket(app.get());
+
+		// The real products are loaded by InitializeStockMarket; the loader appends the copies
+		if (productCount > baseCount)
+		{
+			std::string catalogPath = "benchmark_products_" + std::to_string(productCount) + ".json";
+			if (!WriteScaledProductCatalog(Application::s_dataPath + "item_products.json", catalogPath, productCount - baseCount))
+			{
+				std::cerr << "Failed to write " << catalogPath << std::endl;
+				return nullptr;
+			}
+			market->LoadJsonStockProducts(catalogPath);
+			std::remove(catalogPath.c_str());
+			market->InitializeProductValues();
+		}
+		return app;
+	}
+
+	/// @brief Prints one result line of the console table
+	void PrintResult(const BenchmarkResult& result)
+	{
+		std::cout << std::left << std::setw(40) << result.m_name << std::right << std::fixed << std::setprecision(1)
+			<< std::setw(14) << result.m_medianNs
+			<< std::setw(14) << result.m_minNs
+			<< std::setw(14) << result.m_p95Ns
+			<< std::setw(9) << (result.m_meanNs > 0.0 ? 100.0 * result.m_stddevNs / result.m_meanNs : 0.0) << "%"
+			<< std::setw(12) << result.m_iterationsPerSample << std::endl;
+	}
+
+	/// @brief Writes all results as JSON
+	/// @return True if the file was written
+	bool WriteResults(const std::string& path, const BenchmarkSettings& settings, const std::vector<BenchmarkResult>& results)
+	{
+		Json::StringBuffer buffer;
+		Json::PrettyWriter<Json::StringBuffer> writer(buffer);
+		writer.StartObject();
+		writer.Key("timestamp");
+		writer.Int64(static_cast<int64_t>(std::time(nullptr)));
+#ifdef _DEBUG
+		writer.Key("configuration");
+		writer.String("Debug");
+#else
+		writer.Key("configuration");
+		writer.String("Release");
+#endif
+		writer.Key("seed");
+		writer.Uint(s_randomSeed);
+		writer.Key("samples");
+		writer.Uint(settings.m_samples);
+		writer.Key("minSampleMs");
+		writer.Double(settings.m_minSampleMs);
+		writer.Key("benchmarks");
+		writer.StartArray();
+		for (const BenchmarkResult& result : results)
+		{
+			writer.StartObject();
+			writer.Key("name");
+			writer.String(result.m_name.c_str());
+			writer.Key("iterationsPerSample");
+			writer.Uint64(result.m_iterationsPerSample);
+			writer.Key("medianNs");
+			writer.Double(result.m_medianNs);
+			writer.Key("minNs");
+			writer.Double(result.m_minNs);
+			writer.Key("meanNs");
+			writer.Double(result.m_meanNs);
+			writer.Key("p95Ns");
+			writer.Double(result.m_p95Ns);
+			writer.Key("maxNs");
+			writer.Double(result.m_maxNs);
+			writer.Key("stddevNs");
+			writer.Double(result.m_stddevNs);
+			writer.EndObject();
+		}
+		writer.EndArray();
+		writer.EndObject();
+
+		std::ofstream file(path);
+		file << buffer.GetString() << std::endl;
+		return file.good();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	BenchmarkSettings settings;
+	if (!ParseCommandLine(argc, argv, settings))
+	{
+		return 1;
+	}
+
+	// Keep console output out of the timings; warnings still show up
+	SetDebugLogLevel(DebugType::Warning);
+	Application::s_dataPath = settings.m_dataPath;
+	Application::s_assetsPath = settings.m_assetsPath;
+	Application::GetRandomGenerator().seed(s_randomSeed);
+
+	// Same setup order as Application::Initialize, without a window
+	Application app;
+	app.m_stockMarket = std::make_unique<StockMarket>();
+	app.m_stockMarket->m_dataHotReload = false;
+	app.m_stockMarket->InitializeStockMarket(&app);
+	ApplicationUI applicationUI;
+	applicationUI.InitializeUI(&app);
+	app.m_playerInventory = std::make_unique<Inventory>();
+	app.m_playerInventory->InventoryInitialize(&app);
+	applicationUI.ApplyModelChanges(*app.GetModelChangeBus());
+
+	StockMarket& market = *app.m_stockMarket;
+	Inventory& inventory = *app.m_playerInventory;
+	ModelChangeBus& changeBus = *app.GetModelChangeBus();
+	if (inventory.GetPlayerProducts().empty())
+	{
+		std::cerr << "No products loaded from " << settings.m_dataPath << std::endl;
+		return 1;
+	}
+	const std::string productId = inventory.GetPlayerProducts().front().m_id;
+	const uint32_t startMoney = inventory.GetCurrentMoney();
+	ModelChanges changes;
+
+	std::vector<Benchmark> benchmarks;
+
+	// Market cycle at the shipped catalog size and at two synthetic sizes;
+	// the UI drains the change bus every frame, so the benchmark does too.
+	// Each scaled market has its own application and bus, so the other benchmarks never
+	// drain or mark the changes of tens of thousands of synthetic products
+	const uint32_t baseCount = static_cast<uint32_t>(inventory.GetPlayerProducts().size());
+	std::vector<std::unique_ptr<Application>> scaledApps;
+	for (uint32_t productCount : { 500u, 50000u })
+	{
+		scaledApps.push_back(CreateScaledMarket(baseCount, productCount));
+		if (!scaledApps.back())
+		{
+			return 1;
+		}
+	}
+	ModelChanges scaledChanges[2];
+	benchmarks.push_back({ "StockMarketCycleStep/" + std::to_string(baseCount), [&]() {
+		market.StockMarketCycleStep();
+		changeBus.Drain(changes);
+	} });
+	benchmarks.push_back({ "StockMarketCycleStep/500", [&]() {
+		scaledApps[0]->m_stockMarket->StockMarketCycleStep();
+		scaledApps[0]->GetModelChangeBus()->Drain(scaledChanges[0]);
+	} });
+	benchmarks.push_back({ "StockMarketCycleStep/50000", [&]() {
+		scaledApps[1]->m_stockMarket->StockMarketCycleStep();
+		scaledApps[1]->GetModelChangeBus()->Drain(scaledChanges[1]);
+	} });
+
+	StockProduct* product = market.GetStockProductById(productId);
+	benchmarks.push_back({ "CalculateProductPrice", [&]() {
+		market.CalculateProductPrice(*product);
+	} });
+
+	// Money is reset each round-trip, since selling returns less than buying costs
+	inventory.SetCurrentMoney(startMoney);
+	if (!market.BuyFromStock(productId, 1) || !market.SellForStock(productId, 1))
+	{
+		std::cerr << "Trade round-trip of " << productId << " failed" << std::endl;
+		return 1;
+	}
+	benchmarks.push_back({ "BuySellRoundTrip", [&]() {
+		inventory.SetCurrentMoney(startMoney);
+		market.BuyFromStock(productId, 1);
+		market.SellForStock(productId, 1);
+		changeBus.Drain(changes);
+	} });
+
+	// JSON loaders, each reading its file from disk (file cache warm after the warmup)
+	const std::string productsPath = settings.m_dataPath + "item_products.json";
+	const std::string vendorsPath = settings.m_dataPath + "vendor_characters.json";
+	const std::string newsPath = settings.m_dataPath + "news.json";
+	benchmarks.push_back({ "ParseJsonStockProducts", [&]() {
+		StockProductCatalog catalog = StockMarket::ParseJsonStockProducts(productsPath);
+		s_sink = s_sink + catalog.m_products.size();
+	} });
+	benchmarks.push_back({ "LoadJsonStockVendors", [&]() {
+		StockMarket vendorMarket; // The loader appends, so start empty every time
+		vendorMarket.LoadJsonStockVendors(vendorsPath);
+	} });
+	benchmarks.push_back({ "LoadJsonNews", [&]() {
+		market.LoadJsonNews(newsPath);
+	} });
+	benchmarks.push_back({ "InventoryInitialize", [&]() {
+		Inventory loadedInventory;
+		loadedInventory.InventoryInitialize(nullptr);
+		s_sink = s_sink + loadedInventory.GetPlayerProducts().size();
+	} });
+
+	benchmarks.push_back({ "UpdateInventoryVerticalButtons", [&]() {
+		applicationUI.UpdateInventoryVerticalButtons();
+	} });
+
+	// Alternate two strings so every call changes the text
+	ui::WidgetText text(0, 0, "");
+	const std::string texts[2] = { "Tritanium Ore  x 125", "Neuroflux  x 7" };
+	size_t textIndex = 0;
+	benchmarks.push_back({ "WidgetText::SetText", [&]() {
+		text.SetText(texts[textIndex]);
+		textIndex ^= 1;
+	} });
+
+	// Whole UI into an offscreen target; measures draw submission, the GPU runs asynchronously
+	sf::RenderTexture renderTexture;
+	if (!renderTexture.create(1920, 1080))
+	{
+		std::cerr << "Failed to create the offscreen render target" << std::endl;
+		return 1;
+	}
+	RenderContext renderContext(renderTexture);
+	const ui::WidgetContainer& rootContainer = *applicationUI.GetRootContainer();
+	benchmarks.push_back({ "WidgetContainer::Draw", [&]() {
+		renderContext.BeginFrame();
+		renderContext.clear();
+		rootContainer.Draw(renderContext);
+		renderContext.EndFrame();
+		renderTexture.display();
+	} });
+
+	std::cout << std::left << std::setw(40) << "Benchmark" << std::right
+		<< std::setw(14) << "median ns" << std::setw(14) << "min ns" << std::setw(14) << "p95 ns"
+		<< std::setw(10) << "rsd" << std::setw(12) << "iterations" << std::endl;
+
+	std::vector<BenchmarkResult> results;
+	for (const Benchmark& benchmark : benchmarks)
+	{
+		if (!settings.m_filter.empty() && benchmark.m_name.find(settings.m_filter) == std::string::npos)
+		{
+			continue;
+		}
+		results.push_back(RunBenchmark(benchmark, settings));
+		PrintResult(results.back());
+	}
+
+	if (!WriteResults(settings.m_outputPath, settings, results))
+	{
+		std::cerr << "Failed to write " << settings.m_outputPath << std::endl;
+		return 1;
+	}
+	std::cout << "Results written to " << settings.m_outputPath << std::endl;
+	return 0;
+}
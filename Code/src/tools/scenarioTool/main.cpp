@@ -0,0 +1,710 @@
+#include "pch.h"
+#include "../../application/application.h"
+#include "../../application/inventory.h"
+#include "../../application/stockMarket.h"
+#include "../../application/utilTools.h"
+#include "rapidjson/ostreamwrapper.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/prettywriter.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+// Synthetic scenarios for stress testing.
+//
+// "generate" writes a data set in the game's schema (item_products.json, vendor_characters.json,
+// news.json) plus scenario.json with the starting money and inventory, which the game itself
+// does not read. "run" loads such a folder the way the game does, without a window, runs market
+// cycles and reports load times, peak memory and cycle throughput.
+//
+// Usage: scenarioTool generate <outputDir> [--products=N] [--trend-length=N] [--vendors=N]
+//                              [--news=N] [--inventory=N] [--money=N] [--seed=N]
+//        scenarioTool run <scenarioDir> [--cycles=N] [--output=file]
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr uint32_t s_minProducts = 10;
+	constexpr uint32_t s_maxProducts = 1000000;
+
+	struct GenerateSettings
+	{
+		std::string m_outputDir;
+		uint32_t m_products = 1000;
+		uint32_t m_trendLength = 50;     ///< Entries per product trend curve
+		uint32_t m_vendors = 1000;       ///< One vendor for each of the first N products
+		uint32_t m_news = 200;           ///< Headlines in news.json
+		uint32_t m_inventory = 20;       ///< Products held at the start
+		uint32_t m_money = 10000;        ///< Starting money
+		uint32_t m_seed = 1;
+		bool m_vendorsSet = false;       ///< --vendors given; otherwise one vendor per product
+	};
+
+	struct RunSettings
+	{
+		std::string m_scenarioDir;
+		uint32_t m_cycles = 100;
+		std::string m_outputPath;        ///< Defaults to scenario_report.json in the scenario folder
+	};
+
+	/// Starting state from scenario.json
+	struct ScenarioStart
+	{
+		uint32_t m_seed = 1;
+		uint32_t m_money = 10000;
+		uint32_t m_vendors = 0;
+		uint32_t m_news = 0;
+		std::vector<std::pair<std::string, uint32_t>> m_inventory; ///< Product id, quantity
+	};
+
+	// Word parts for generated names; names are practically unique, so news tags single products
+	const char* const s_syllables[] = {
+		"ka", "ro", "zen", "tri", "lu", "nex", "vor", "qua", "mi", "dra", "sol", "fer", "ion", "cy", "tal", "pho",
+		"gra", "neu", "ze", "lum", "ta", "xo", "ven", "ri", "ox", "bel", "sar", "thu", "mo", "ki", "dun", "ae" };
+	const char* const s_kinds[] = { "Ore", "Crystal", "Alloy", "Core", "Cell", "Dust", "Fiber", "Gel" };
+	const char* const s_companySuffixes[] = { "Dynamics", "Industries", "Systems", "Labs", "Holdings", "Works" };
+	const char* const s_rarities[] = { "Common", "Normal", "Rare" };
+	const char* const s_roles[] = { "CEO", "Founder", "Chief Trader", "Director" };
+	const char* const s_places[] = { "Tokyo", "Oslo", "Mars orbit", "Dubai", "Chile", "Zurich", "Seoul", "the Belt" };
+
+	// Sentiment keywords of the generated news.json; a trailing '*' marks a stem
+	const std::pair<const char*, double> s_sentiment[] = {
+		{ "rise*", 0.03 }, { "soar*", 0.05 }, { "surge*", 0.05 }, { "record", 0.04 }, { "expand*", 0.02 },
+		{ "plunge*", -0.05 }, { "drop*", -0.04 }, { "fall*", -0.04 }, { "recall*", -0.04 }, { "scandal", -0.04 } };
+	const char* const s_headlineVerbs[] = { "rises", "soars", "surges", "posts record", "expands", "plunges", "drops", "falls", "recalls", "faces scandal" };
+
+	/// @brief Reads the value of a --name=value option
+	/// @return True if the argument is this option
+	bool ReadOption(const std::string& argument, const char* option, std::string& value)
+	{
+		size_t length = std::strlen(option);
+		if (argument.compare(0, length, option) != 0)
+		{
+			return false;
+		}
+		value = argument.substr(length);
+		return true;
+	}
+
+	/// @brief Reads an unsigned option value
+	/// @return False if the value is not a number
+	bool ReadUint(const std::string& value, uint32_t& result)
+	{
+		char* end = nullptr;
+		unsigned long parsed = std::strtoul(value.c_str(), &end, 10);
+		if (value.empty() || *end != '\0')
+		{
+			return false;
+		}
+		result = static_cast<uint32_t>(parsed);
+		return true;
+	}
+
+	/// @brief Appends a path separator if missing
+	std::string WithTrailingSeparator(const std::string& path)
+	{
+		if (path.empty() || path.back() == '/' || path.back() == '\\')
+		{
+			return path;
+		}
+		return path + "/";
+	}
+
+	/// @brief Creates a directory if it does not exist yet
+	/// @return True if the directory exists afterwards
+	bool CreateDirectoryIfMissing(const std::string& path)
+	{
+		struct stat info;
+		if (stat(path.c_str(), &info) == 0)
+		{
+			return (info.st_mode & S_IFDIR) != 0;
+		}
+#ifdef _WIN32
+		return _mkdir(path.c_str()) == 0;
+#else
+		return mkdir(path.c_str(), 0755) == 0;
+#endif
+	}
+
+	/// @brief Pseudo-word for an index, capitalized ("Kazentri"); four syllables give 32^4 words
+	std::string MakeWord(uint32_t index)
+	{
+		const uint32_t syllableCount = sizeof(s_syllables) / sizeof(s_syllables[0]);
+		// Odd multiplier modulo 2^20 is a permutation, so neighbouring indices get unrelated words
+		index = (index * 2654435761u) & 0xFFFFF;
+		std::string word;
+		for (int i = 0; i < 4; ++i)
+		{
+			word += s_syllables[index % syllableCount];
+			index /= syllableCount;
+		}
+		word[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(word[0])));
+		return word;
+	}
+
+	std::string MakeProductId(uint32_t index)
+	{
+		return "P" + std::to_string(index);
+	}
+
+	std::string MakeProductName(uint32_t index)
+	{
+		return MakeWord(index) + " " + s_kinds[index % (sizeof(s_kinds) / sizeof(s_kinds[0]))];
+	}
+
+	std::string MakeCompanyName(uint32_t index)
+	{
+		return MakeWord(index) + " " + s_companySuffixes[index % (sizeof(s_companySuffixes) / sizeof(s_companySuffixes[0]))];
+	}
+
+	/// @brief Parses the options of the generate command
+	/// @return False on an unknown option or a value out of range
+	bool ParseGenerateOptions(int argc, char* argv[], GenerateSettings& settings)
+	{
+		settings.m_outputDir = WithTrailingSeparator(argv[2]);
+		for (int i = 3; i < argc; ++i)
+		{
+			std::string argument = argv[i];
+			std::string value;
+			bool valid = true;
+			if (ReadOption(argument, "--products=", value))
+			{
+				valid = ReadUint(value, settings.m_products) && settings.m_products >= s_minProducts && settings.m_products <= s_maxProducts;
+			}
+			else if (ReadOption(argument, "--trend-length=", value))
+			{
+				valid = ReadUint(value, settings.m_trendLength) && settings.m_trendLength > 0;
+			}
+			else if (ReadOption(argument, "--vendors=", value))
+			{
+				valid = ReadUint(value, settings.m_vendors);
+				settings.m_vendorsSet = true;
+			}
+			else if (ReadOption(argument, "--news=", value))
+			{
+				valid = ReadUint(value, settings.m_news) && settings.m_news > 0;
+			}
+			else if (ReadOption(argument, "--inventory=", value))
+			{
+				valid = ReadUint(value, settings.m_inventory);
+			}
+			else if (ReadOption(argument, "--money=", value))
+			{
+				valid = ReadUint(value, settings.m_money);
+			}
+			else if (ReadOption(argument, "--seed=", value))
+			{
+				valid = ReadUint(value, settings.m_seed);
+			}
+			else
+			{
+				std::cerr << "Unknown option: " << argument << std::endl;
+				return false;
+			}
+
+			if (!valid)
+			{
+				std::cerr << "Invalid value: " << argument << " (products: " << s_minProducts << " to " << s_maxProducts << ")" << std::endl;
+				return false;
+			}
+		}
+
+		if (!settings.m_vendorsSet)
+		{
+			settings.m_vendors = settings.m_products;
+		}
+		if (settings.m_vendors > settings.m_products || settings.m_inventory > settings.m_products)
+		{
+			std::cerr << "--vendors and --inventory can not exceed --products" << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	/// @brief Writes item_products.json
+	bool WriteProducts(const GenerateSettings& settings, std::mt19937& random)
+	{
+		std::ofstream file(settings.m_outputDir + "item_products.json", std::ios::binary);
+		Json::OStreamWrapper stream(file);
+		Json::Writer<Json::OStreamWrapper> writer(stream);
+		writer.SetMaxDecimalPlaces(4);
+
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+		std::uniform_real_distribution<float> trendStep(-0.15f, 0.15f);
+		writer.StartObject();
+		writer.Key("products");
+		writer.StartArray();
+		for (uint32_t i = 0; i < settings.m_products; ++i)
+		{
+			std::string id = MakeProductId(i);
+			std::string name = MakeProductName(i);
+			writer.StartObject();
+			writer.Key("id");
+			writer.String(id.c_str());
+			writer.Key("name");
+			writer.String(name.c_str());
+			writer.Key("volume");
+			writer.Double(0.1 + std::floor(unit(random) * 200.0f) / 10.0);
+			writer.Key("basePrice");
+			writer.Int(10 + static_cast<int>(unit(random) * 4990.0f));
+			writer.Key("playerImpact");
+			writer.Double(0.01 + unit(random) * 0.09);
+			writer.Key("minPrice");
+			writer.Double(0.1 + unit(random) * 0.4);
+			writer.Key("maxPrice");
+			writer.Double(1.5 + unit(random) * 1.5);
+
+			// Random walk clamped to [0, 1], like the hand-made curves
+			writer.Key("trends");
+			writer.StartArray();
+			float trend = unit(random);
+			for (uint32_t j = 0; j < settings.m_trendLength; ++j)
+			{
+				writer.Double(trend);
+				trend = std::max(0.0f, std::min(1.0f, trend + trendStep(random)));
+			}
+			writer.EndArray();
+
+			writer.Key("itemRarity");
+			writer.String(s_rarities[i % 3]);
+			writer.Key("stackReplenishment");
+			writer.Int(1 + static_cast<int>(unit(random) * 9.0f));
+			writer.Key("sellStackRatio");
+			writer.Double(0.2 + unit(random) * 0.6);
+			writer.Key("maxQuantity");
+			writer.Int(50 + static_cast<int>(unit(random) * 950.0f));
+			writer.Key("productInfo");
+			writer.String(("Synthetic product\n" + name + ".").c_str());
+			writer.EndObject();
+		}
+		writer.EndArray();
+		writer.EndObject();
+		file.flush();
+		return file.good();
+	}
+
+	/// @brief Writes vendor_characters.json
+	bool WriteVendors(const GenerateSettings& settings, std::mt19937& random)
+	{
+		std::ofstream file(settings.m_outputDir + "vendor_characters.json", std::ios::binary);
+		Json::OStreamWrapper stream(file);
+		Json::Writer<Json::OStreamWrapper> writer(stream);
+
+		std::uniform_int_distribution<int> trait(0, 10);
+		writer.StartObject();
+		writer.Key("characters");
+		writer.StartArray();
+		for (uint32_t i = 0; i < settings.m_vendors; ++i)
+		{
+			std::string productId = MakeProductId(i);
+			const char* role = s_roles[i % (sizeof(s_roles) / sizeof(s_roles[0]))];
+			writer.StartObject();
+			writer.Key("id");
+			writer.String((productId + "_VENDOR").c_str());
+			writer.Key("product_id");
+			writer.String(productId.c_str());
+			writer.Key("name");
+			writer.String(("Vendor " + MakeWord(i)).c_str());
+			writer.Key("company");
+			writer.String(MakeCompanyName(i).c_str());
+			writer.Key("role");
+			writer.String(role);
+			writer.Key("profile");
+			writer.String("Synthetic vendor\nfor stress tests.");
+			writer.Key("appearance");
+			writer.String("Generated.");
+			writer.Key("mood");
+			writer.String("Neutral");
+			writer.Key("colorTheme");
+			writer.StartArray();
+			writer.String("#3B6EA5");
+			writer.String("#D6A23D");
+			writer.EndArray();
+			writer.Key("quote");
+			writer.String("Numbers never sleep.");
+			writer.Key("personality");
+			writer.StartObject();
+			writer.Key("discipline");
+			writer.Int(trait(random));
+			writer.Key("riskTaking");
+			writer.Int(trait(random));
+			writer.Key("greed");
+			writer.Int(trait(random));
+			writer.Key("honor");
+			writer.Int(trait(random));
+			writer.EndObject();
+			writer.Key("style");
+			writer.String("Generated.");
+			writer.Key("companyInfo");
+			writer.String("Synthetic company.");
+			writer.EndObject();
+		}
+		writer.EndArray();
+		writer.EndObject();
+		file.flush();
+		return file.good();
+	}
+
+	/// @brief Writes news.json; every headline names a random product and a sentiment keyword
+	bool WriteNews(const GenerateSettings& settings, std::mt19937& random)
+	{
+		std::ofstream file(settings.m_outputDir + "news.json", std::ios::binary);
+		Json::OStreamWrapper stream(file);
+		Json::Writer<Json::OStreamWrapper> writer(stream);
+
+		const uint32_t verbCount = sizeof(s_headlineVerbs) / sizeof(s_headlineVerbs[0]);
+		const uint32_t placeCount = sizeof(s_places) / sizeof(s_places[0]);
+		std::uniform_int_distribution<uint32_t> product(0, settings.m_products - 1);
+		std::uniform_int_distribution<uint32_t> percent(1, 12);
+
+		writer.StartObject();
+		writer.Key("sentiment");
+		writer.StartObject();
+		for (const auto& keyword : s_sentiment)
+		{
+			writer.Key(keyword.first);
+			writer.Double(keyword.second);
+		}
+		writer.EndObject();
+		writer.Key("news");
+		writer.StartArray();
+		for (uint32_t i = 0; i < settings.m_news; ++i)
+		{
+			std::string headline = MakeProductName(product(random)) + " " + s_headlineVerbs[i % verbCount] + " " +
+				std::to_string(percent(random)) + "% in " + s_places[(i / verbCount) % placeCount];
+			writer.String(headline.c_str());
+		}
+		writer.EndArray();
+		writer.EndObject();
+		file.flush();
+		return file.good();
+	}
+
+	/// @brief Writes scenario.json with the generation settings and the starting state
+	bool WriteScenario(const GenerateSettings& settings, std::mt19937& random)
+	{
+		// Distinct products for the starting inventory
+		std::vector<uint32_t> productIndices(settings.m_products);
+		for (uint32_t i = 0; i < settings.m_products; ++i)
+		{
+			productIndices[i] = i;
+		}
+		for (uint32_t i = 0; i < settings.m_inventory; ++i)
+		{
+			std::uniform_int_distribution<uint32_t> pick(i, settings.m_products - 1);
+			std::swap(productIndices[i], productIndices[pick(random)]);
+		}
+		std::uniform_int_distribution<uint32_t> quantity(1, 20);
+
+		std::ofstream file(settings.m_outputDir + "scenario.json", std::ios::binary);
+		Json::OStreamWrapper stream(file);
+		Json::PrettyWriter<Json::OStreamWrapper> writer(stream);
+		writer.StartObject();
+		writer.Key("seed");
+		writer.Uint(settings.m_seed);
+		writer.Key("products");
+		writer.Uint(settings.m_products);
+		writer.Key("trendLength");
+		writer.Uint(settings.m_trendLength);
+		writer.Key("vendors");
+		writer.Uint(settings.m_vendors);
+		writer.Key("news");
+		writer.Uint(settings.m_news);
+		writer.Key("startingMoney");
+		writer.Uint(settings.m_money);
+		writer.Key("startingInventory");
+		writer.StartArray();
+		for (uint32_t i = 0; i < settings.m_inventory; ++i)
+		{
+			writer.StartObject();
+			writer.Key("id");
+			writer.String(MakeProductId(productIndices[i]).c_str());
+			writer.Key("quantity");
+			writer.Uint(quantity(random));
+			writer.EndObject();
+		}
+		writer.EndArray();
+		writer.EndObject();
+		file << std::endl;
+		return file.good();
+	}
+
+	/// @brief Runs the generate command
+	/// @return Process exit code
+	int Generate(const GenerateSettings& settings)
+	{
+		if (!CreateDirectoryIfMissing(settings.m_outputDir))
+		{
+			std::cerr << "Failed to create output directory: " << settings.m_outputDir << std::endl;
+			return 1;
+		}
+
+		std::mt19937 random(settings.m_seed);
+		if (!WriteProducts(settings, random) || !WriteVendors(settings, random) || !WriteNews(settings, random) || !WriteScenario(settings, random))
+		{
+			std::cerr << "Failed to write the scenario to " << settings.m_outputDir << std::endl;
+			return 1;
+		}
+
+		std::cout << "Wrote " << settings.m_products << " products (" << settings.m_trendLength << " trend entries each), "
+			<< settings.m_vendors << " vendors, " << settings.m_news << " headlines and " << settings.m_inventory
+			<< " starting inventory entries to " << settings.m_outputDir << std::endl;
+		return 0;
+	}
+
+	/// @brief Parses the options of the run command
+	/// @return False on an unknown option or invalid value
+	bool ParseRunOptions(int argc, char* argv[], RunSettings& settings)
+	{
+		settings.m_scenarioDir = WithTrailingSeparator(argv[2]);
+		settings.m_outputPath = settings.m_scenarioDir + "scenario_report.json";
+		for (int i = 3; i < argc; ++i)
+		{
+			std::string argument = argv[i];
+			std::string value;
+			if (ReadOption(argument, "--cycles=", value))
+			{
+				if (!ReadUint(value, settings.m_cycles) || settings.m_cycles == 0)
+				{
+					std::cerr << "Invalid value: " << argument << std::endl;
+					return false;
+				}
+			}
+			else if (ReadOption(argument, "--output=", value))
+			{
+				settings.m_outputPath = value;
+			}
+			else
+			{
+				std::cerr << "Unknown option: " << argument << std::endl;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// @brief Reads scenario.json; a folder without one (e.g. the shipped data) uses the defaults
+	void LoadScenarioStart(const std::string& path, ScenarioStart& start)
+	{
+		std::ifstream stream(path, std::ios::binary);
+		if (!stream.is_open())
+		{
+			std::cout << "No scenario.json, using the default starting state" << std::endl;
+			return;
+		}
+		std::string fileData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		Json::Document document;
+		document.Parse(fileData.c_str());
+		if (document.HasParseError() || !document.IsObject())
+		{
+			std::cerr << "Invalid " << path << ", using the default starting state" << std::endl;
+			return;
+		}
+
+		auto readUint = [&document](const char* name, uint32_t& value) {
+			if (document.HasMember(name) && document[name].IsUint())
+			{
+				value = document[name].GetUint();
+			}
+		};
+		readUint("seed", start.m_seed);
+		readUint("startingMoney", start.m_money);
+		readUint("vendors", start.m_vendors);
+		readUint("news", start.m_news);
+
+		if (document.HasMember("startingInventory") && document["startingInventory"].IsArray())
+		{
+			const Json::Value& inventory = document["startingInventory"];
+			for (Json::SizeType i = 0; i < inventory.Size(); i++)
+			{
+				const Json::Value& entry = inventory[i];
+				if (entry.IsObject() && entry.HasMember("id") && entry["id"].IsString() && entry.HasMember("quantity") && entry["quantity"].IsUint())
+				{
+					start.m_inventory.emplace_back(entry["id"].GetString(), entry["quantity"].GetUint());
+				}
+			}
+		}
+	}
+
+	double ElapsedMs(Clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	double PeakMemoryMB()
+	{
+		return static_cast<double>(GetPeakMemoryBytes()) / (1024.0 * 1024.0);
+	}
+
+	/// @brief Runs the run command
+	/// @return Process exit code
+	int Run(const RunSettings& settings)
+	{
+		ScenarioStart start;
+		LoadScenarioStart(settings.m_scenarioDir + "scenario.json", start);
+
+		// The loaders log every product; only keep warnings and errors
+		SetDebugLogLevel(DebugType::Warning);
+		Application::s_dataPath = settings.m_scenarioDir;
+		Application::GetRandomGenerator().seed(start.m_seed);
+		std::cout << std::fixed << std::setprecision(1);
+
+		// Phases are printed as they finish, so a run that runs out of memory still shows how far it got
+		Application app;
+		Clock::time_point phaseStart = Clock::now();
+		app.m_stockMarket = std::make_unique<StockMarket>();
+		app.m_stockMarket->InitializeStockMarket(&app);
+		double marketLoadMs = ElapsedMs(phaseStart);
+		double marketPeakMB = PeakMemoryMB();
+		std::cout << "Market load:    " << marketLoadMs << " ms, peak memory " << marketPeakMB << " MB" << std::endl;
+
+		phaseStart = Clock::now();
+		app.m_playerInventory = std::make_unique<Inventory>();
+		app.m_playerInventory->InventoryInitialize(&app);
+		app.m_playerInventory->SetCurrentMoney(start.m_money);
+		for (const auto& entry : start.m_inventory)
+		{
+			app.m_playerInventory->AddProduct(entry.first, entry.second);
+		}
+		double inventoryLoadMs = ElapsedMs(phaseStart);
+		double inventoryPeakMB = PeakMemoryMB();
+		std::cout << "Inventory load: " << inventoryLoadMs << " ms, peak memory " << inventoryPeakMB << " MB" << std::endl;
+
+		const size_t productCount = app.m_playerInventory->GetPlayerProducts().size();
+		if (productCount == 0)
+		{
+			std::cerr << "No products loaded from " << settings.m_scenarioDir << std::endl;
+			return 1;
+		}
+
+		// One market cycle as the game runs it: cycle step, next headline, UI change drain
+		ModelChanges changes;
+		std::vector<double> cycleMs(settings.m_cycles);
+		Clock::time_point cyclesStart = Clock::now();
+		for (double& cycle : cycleMs)
+		{
+			phaseStart = Clock::now();
+			app.m_stockMarket->RunMarketCycle();
+			app.m_stockMarket->GetNextNews();
+			app.GetModelChangeBus()->Drain(changes);
+			cycle = ElapsedMs(phaseStart);
+			MEMORY_END_FRAME();
+		}
+		double cyclesTotalMs = ElapsedMs(cyclesStart);
+		double finalPeakMB = PeakMemoryMB();
+
+		std::sort(cycleMs.begin(), cycleMs.end());
+		double medianCycleMs = cycleMs[cycleMs.size() / 2];
+		double maxCycleMs = cycleMs.back();
+		double cyclesPerSecond = settings.m_cycles * 1000.0 / std::max(cyclesTotalMs, 1.0e-6);
+		double productUpdatesPerSecond = cyclesPerSecond * static_cast<double>(productCount);
+		std::cout << "Cycles:         " << settings.m_cycles << " in " << cyclesTotalMs << " ms, median " << std::setprecision(3)
+			<< medianCycleMs << " ms, max " << maxCycleMs << " ms, " << std::setprecision(1) << cyclesPerSecond << " cycles/s, "
+			<< productUpdatesPerSecond << " product updates/s" << std::endl;
+		std::cout << "Peak memory:    " << finalPeakMB << " MB" << std::endl;
+		if (MemoryTracker::IsEnabled())
+		{
+			// Per subsystem heap use; violations count allocations in the cycle step's product loop
+			MemoryTracker::Get().WriteReport(std::cout, 10);
+		}
+
+		std::ofstream file(settings.m_outputPath);
+		Json::OStreamWrapper stream(file);
+		Json::PrettyWriter<Json::OStreamWrapper> writer(stream);
+		writer.StartObject();
+		writer.Key("scenario");
+		writer.String(settings.m_scenarioDir.c_str());
+		writer.Key("products");
+		writer.Uint64(productCount);
+		writer.Key("vendors");
+		writer.Uint(start.m_vendors);
+		writer.Key("news");
+		writer.Uint(start.m_news);
+		writer.Key("marketLoadMs");
+		writer.Double(marketLoadMs);
+		writer.Key("inventoryLoadMs");
+		writer.Double(inventoryLoadMs);
+		writer.Key("peakMemoryAfterMarketLoadMB");
+		writer.Double(marketPeakMB);
+		writer.Key("peakMemoryAfterInventoryLoadMB");
+		writer.Double(inventoryPeakMB);
+		writer.Key("peakMemoryMB");
+		writer.Double(finalPeakMB);
+		writer.Key("cycles");
+		writer.Uint(settings.m_cycles);
+		writer.Key("cyclesTotalMs");
+		writer.Double(cyclesTotalMs);
+		writer.Key("medianCycleMs");
+		writer.Double(medianCycleMs);
+		writer.Key("maxCycleMs");
+		writer.Double(maxCycleMs);
+		writer.Key("cyclesPerSecond");
+		writer.Double(cyclesPerSecond);
+		writer.Key("productUpdatesPerSecond");
+		writer.Double(productUpdatesPerSecond);
+		if (MemoryTracker::IsEnabled())
+		{
+			const MemoryTracker& tracker = MemoryTracker::Get();
+			writer.Key("liveHeapMB");
+			writer.StartObject();
+			for (int tag = 0; tag < static_cast<int>(MemoryTag::MAX); ++tag)
+			{
+				writer.Key(MemoryTracker::GetTagName(static_cast<MemoryTag>(tag)));
+				writer.Double(static_cast<double>(tracker.GetTagStats(static_cast<MemoryTag>(tag)).m_liveBytes) / (1024.0 * 1024.0));
+			}
+			writer.EndObject();
+			writer.Key("noAllocViolations");
+			writer.Uint64(tracker.GetNoAllocViolations());
+		}
+		writer.EndObject();
+		file << std::endl;
+		if (!file.good())
+		{
+			std::cerr << "Failed to write " << settings.m_outputPath << std::endl;
+			return 1;
+		}
+		std::cout << "Report written to " << settings.m_outputPath << std::endl;
+		return 0;
+	}
+
+	void PrintUsage()
+	{
+		std::cerr << "Usage: scenarioTool generate <outputDir> [--products=N] [--trend-length=N] [--vendors=N]" << std::endl
+			<< "                             [--news=N] [--inventory=N] [--money=N] [--seed=N]" << std::endl
+			<< "       scenarioTool run <scenarioDir> [--cycles=N] [--output=file]" << std::endl;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::string command = argv[1];
+	if (command == "generate")
+	{
+		GenerateSettings settings;
+		return ParseGenerateOptions(argc, argv, settings) ? Generate(settings) : 1;
+	}
+	if (command == "run")
+	{
+		RunSettings settings;
+		return ParseRunOptions(argc, argv, settings) ? Run(settings) : 1;
+	}
+
+	PrintUsage();
+	return 1;
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+#include "../../application/pch.h"